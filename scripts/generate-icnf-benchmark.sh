@@ -0,0 +1,38 @@
+#!/bin/sh
+
+# Generates an incremental CNF (iCNF) benchmark on '<stdout>' with many
+# short queries.  It starts with a random 3-CNF below the threshold and
+# then each query adds another random clause and assumes a few literals.
+# This mimics typical incremental use (bounded model checking, MaxSAT etc.)
+# and is meant to measure the average time per query, e.g.,
+#
+#   scripts/generate-icnf-benchmark.sh 1 2000 1000 > /tmp/bench.icnf
+#   time build/cadical -q /tmp/bench.icnf
+
+die () {
+  echo "*** generate-icnf-benchmark.sh: $*" 1>&2
+  exit 1
+}
+
+[ $# = 3 ] || die "usage: generate-icnf-benchmark.sh <seed> <vars> <queries>"
+
+awk -v seed=$1 -v vars=$2 -v queries=$3 '
+function lit () {
+  return (rand () < 0.5 ? -1 : 1) * (1 + int (rand () * vars))
+}
+function clause (k,  i) {
+  for (i = 0; i < k; i++) printf "%d ", lit ()
+  print 0
+}
+BEGIN {
+  srand (seed)
+  print "p inccnf"
+  for (i = 0; i < int (3 * vars); i++) clause(3)
+  for (q = 0; q < queries; q++) {
+    clause(5)
+    printf "a"
+    k = 1 + int (rand () * 5)
+    for (i = 0; i < k; i++) printf " %d", lit ()
+    print " 0"
+  }
+}'
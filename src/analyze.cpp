@@ -53,6 +53,12 @@ struct bumped_earlier {
   }
 };
 
+struct not_assumed {
+  Internal * internal;
+  not_assumed (Internal * i) : internal (i) { }
+  bool operator () (int lit) { return !internal->flags (lit).assumed; }
+};
+
 struct trail_bumped_smaller {
   Internal * internal;
   trail_bumped_smaller (Internal * i) : internal (i) { }
@@ -73,8 +79,13 @@ void Internal::bump_variables () {
   // queue and seems to work best.  We also experimented with focusing on
   // variables of the last decision level, but results were mixed.
 
-  sort (analyzed.begin (), analyzed.end (), bumped_earlier (this));
-  for (const_int_iterator i = analyzed.begin (); i != analyzed.end (); i++)
+  // Assumed variables are decided first anyhow and thus are not bumped,
+  // which matters with many assumptions, e.g., the selectors of 'core'.
+
+  const int_iterator end = assumptions.empty () ? analyzed.end () :
+    partition (analyzed.begin (), analyzed.end (), not_assumed (this));
+  sort (analyzed.begin (), end, bumped_earlier (this));
+  for (const_int_iterator i = analyzed.begin (); i != end; i++)
     bump_variable (*i);
 
   STOP (bump);
@@ -82,13 +93,47 @@ void Internal::bump_variables () {
 
 /*------------------------------------------------------------------------*/
 
-// Clause activity is replaced by a move-to-front scheme as well with
-// 'analyzed' as time stamp.  Only long and high glue clauses are stamped
-// since small or low glue clauses are kept anyhow (and do not actually have
-// a 'analyzed' field).  We keep the relative order of bumped clauses by
-// sorting them first.
+// Clause activity is replaced by marking clauses as 'used' and for learned
+// clauses, which are not kept anyhow, also storing the conflict number of
+// their last use in 'used_at' (see 'reduce.cpp').  Their glue is recomputed
+// too, since it usually decreases over time.  If the glue drops to
+// 'keepglue' the clause is promoted to the core clauses, which are kept.
+// As in Glucose for incremental solving the levels of assumptions are not
+// counted, since with many assumptions, as the selectors of 'core', almost
+// all learned clauses would otherwise get a huge glue.  As in 'analyze'
+// the root level is not counted either.
+
+int Internal::recompute_glue (Clause * c) {
+  const long stamp = ++stats.recomputed;
+  const int assumed = (int) assumptions.size ();
+  int res = 0;
+  const const_literal_iterator end = c->end ();
+  for (const_literal_iterator i = c->begin (); i != end; i++) {
+    const int tmp = var (*i).level;
+    if (!tmp || tmp <= assumed) continue;
+    Level & l = control[tmp];
+    if (l.stamp == stamp) continue;
+    l.stamp = stamp;
+    res++;
+  }
+  if (!res) res = 1;
+  return res;
+}
 
-inline void Internal::bump_clause (Clause * c) { c->used = true; }
+inline void Internal::bump_clause (Clause * c) {
+  c->used = true;
+  if (c->keep) return;
+  assert (c->redundant), assert (c->extended);
+  c->used_at = stats.conflicts;
+  const int glue = recompute_glue (c);
+  if (glue >= c->glue) return;
+  LOG (c, "glue decreased to %d", glue);
+  c->glue = glue;
+  if (glue > opts.keepglue) return;
+  LOG (c, "promoting to core");
+  stats.promoted++;
+  c->keep = true;
+}
 
 /*------------------------------------------------------------------------*/
 
@@ -113,7 +158,7 @@ inline void Internal::analyze_literal (int lit, int & open) {
     LOG ("found new level %d contributing to conflict", v.level);
     levels.push_back (v.level);
   }
-  if (v.trail < l.trail) l.trail = v.trail;
+  if (v.trail < l.earliest) l.earliest = v.trail;
   f.seen = true;
   analyzed.push_back (lit);
   LOG ("analyzed literal %d assigned at level %d", lit, v.level);
@@ -154,6 +199,15 @@ void Internal::clear_levels () {
 
 /*------------------------------------------------------------------------*/
 
+struct trail_rank {
+  Internal * internal;
+  trail_rank (Internal * s) : internal (s) { }
+  unsigned operator () (int lit) {
+    assert (internal->val (lit));
+    return internal->var (lit).trail;
+  }
+};
+
 struct trail_larger {
   Internal * internal;
   trail_larger (Internal * s) : internal (s) { }
@@ -180,6 +234,8 @@ void Internal::analyze () {
       ;
     if (!--open) break;
     reason = var (uip).reason;
+    if (reason == &atmost_reason) reason = explain_atmost (uip);
+    else if (reason == &xor_reason) reason = explain_xor (uip);
     LOG (reason, "analyzing %d reason", uip);
   }
   LOG ("first UIP %d", uip);
@@ -187,13 +243,19 @@ void Internal::analyze () {
 
   external->check_learned_clause ();
 
-  // Update glue statistics.
+  // Update glue statistics, where assumption levels are not counted (see
+  // 'recompute_glue' above).
   //
-  const int glue = (int) levels.size ();
+  int glue = 0;
+  const int assumed = (int) assumptions.size ();
+  for (const_int_iterator l = levels.begin (); l != levels.end (); l++)
+    if (*l > assumed) glue++;
+  if (!glue) glue = 1;
   LOG ("1st UIP clause of size %ld and glue %d",
     (long) clause.size (), glue);
   UPDATE_AVERAGE (fast_glue_avg, glue);
   UPDATE_AVERAGE (slow_glue_avg, glue);
+  if (stable) stats.stable.conflicts++;
 
   // Update learned = 1st UIP literals counter.
   //
@@ -201,13 +263,25 @@ void Internal::analyze () {
   stats.learned += size;
 
   // Minimize 1st UIP clause as pioneered by MiniSAT and described in our
-  // SAT'09 paper.
+  // SAT'09 paper and then shrink it to one literal per level if possible.
+  // Both expect the clause to be sorted with respect to the trail.  Finally
+  // remove literals implied by the asserting literal through binary clauses,
+  // which requires to traverse all its watches and thus is restricted to
+  // clauses with small glue as in Glucose.
   //
   if (size > 1) {
+    rsort (clause.begin (), clause.end (), trail_rank (this));
     if (opts.minimize) minimize_clause ();
+    if (opts.shrink) shrink_clause ();
+    if (opts.minimizebin && glue <= opts.minimizebinglue)
+      bin_minimize_clause ();
     size = (int) clause.size ();
   }
 
+  // Export the minimized clause to a connected learner.
+  //
+  if (external->learner) external->export_learned_clause (clause);
+
   // Update actual size statistics.
   //
   stats.units    += (size == 1);
@@ -216,7 +290,8 @@ void Internal::analyze () {
 
   // Update decision heuristics.
   //
-  bump_variables ();
+  if (scoring) bump_scores ();
+  else bump_variables ();
 
   // Determine back jump level, backtrack and assign flipped literal.
   //
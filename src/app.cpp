@@ -5,6 +5,7 @@
 #include "app.hpp"
 #include "cadical.hpp"
 #include "file.hpp"
+#include "server.hpp"
 #include "signal.hpp"
 
 /*------------------------------------------------------------------------*/
@@ -62,6 +63,12 @@ void App::usage () {
 "\n"
 "  -t <sec>   set a wall clock time limit in seconds\n"
 "\n"
+"  --backbone  print backbone literals in 'b' lines instead of witness\n"
+"  --phases=<file>  read initial phases from file with literals\n"
+"\n"
+"  --serve <socket>  serve sessions on a local UNIX domain socket\n"
+"  --workers <n>     number of server worker processes (default 4)\n"
+"\n"
 "or '<option>' can be one of the following long options\n"
 "\n",
   stdout);
@@ -82,6 +89,10 @@ fputs (
 "format unless '--binary=0' or the proof is written to '<stdout>'\n"
 "and '<stdout>' is connected to a terminal.\n"
 "\n"
+"If '<dimacs>' is an incremental CNF with 'p inccnf' header, then\n"
+"the formula is solved after each assumption line 'a <lit> ... 0'\n"
+"under these assumptions and the result of each query is printed.\n"
+"\n"
 "The input is assumed to be compressed if it is given explicitly\n"
 "and has a '.gz', '.bz2', '.xz or '.7z' suffix.  The same applies to\n"
 "the output file.  For compression and decompression the utilities\n"
@@ -91,25 +102,51 @@ fputs (
 
 /*------------------------------------------------------------------------*/
 
-// Pretty print competition format witness with 'v' lines.
+// Pretty print competition format lines of literals, e.g., with 'type' 'v'
+// for the witness and 'b' for the backbone.
 //
-void App::witness () {
-  int c = 0, m = solver->max ();
+void App::lines (char type, const std::vector<int> & lits) {
+  int c = 0;
   File * output = solver->output ();
-  for (int i = 1; i <= m; i++) {
-    if (!c) output->put ('v'), c = 1;
+  for (size_t i = 0; i < lits.size (); i++) {
+    if (!c) output->put (type), c = 1;
     char str[20];
-    sprintf (str, " %d", solver->val (i) < 0 ? -i : i);
+    sprintf (str, " %d", lits[i]);
     int l = strlen (str);
-    if (c + l > 78) output->put ("\nv"), c = 1;
+    if (c + l > 78) output->put ('\n'), output->put (type), c = 1;
     output->put (str);
     c += l;
   }
   if (c) output->put ('\n');
-  output->put ("v 0\n");
+  output->put (type), output->put (" 0\n");
   fflush (stdout);
 }
 
+void App::witness () {
+  std::vector<int> lits;
+  for (int i = 1, m = solver->max (); i <= m; i++)
+    lits.push_back (solver->val (i) < 0 ? -i : i);
+  lines ('v', lits);
+}
+
+// Print the status line and (if requested) the witness or the backbone.
+//
+void App::result (int res, const std::vector<int> * backbone) {
+  if (res == 10) {
+    printf ("s SATISFIABLE\n");
+    fflush (stdout);
+    if (backbone) lines ('b', *backbone);
+    else if (solver->get ("witness")) witness ();
+    fflush (stdout);
+  } else if (res == 20) {
+    printf ("s UNSATISFIABLE\n");
+    fflush (stdout);
+  } else {
+    printf ("c UNKNOWN\n");
+    fflush (stdout);
+  }
+}
+
 /*------------------------------------------------------------------------*/
 
 // Wrapper around option setting.
@@ -127,9 +164,11 @@ do { solver->error (FMT,##ARGS); res = 1; goto DONE; } while (0)
 
 int App::main (int argc, char ** argv) {
   const char * proof_path = 0, * solution_path = 0, * dimacs_path = 0;
-  bool proof_specified = false, dimacs_specified = false;
+  const char * socket_path = 0, * phases_path = 0;
+  bool proof_specified = false, dimacs_specified = false, backbone = false;
   const char * dimacs_name, * err;
-  int i, res = 0, time_limit = -1;
+  int i, res = 0, time_limit = -1, workers = -1;
+  std::vector<const char *> options;
   solver = new Solver ();
   Signal::init (solver);
   for (i = 1; i < argc; i++) {
@@ -149,6 +188,20 @@ int App::main (int argc, char ** argv) {
       else if (time_limit >= 0) ERROR ("multiple time limits");
       else if ((time_limit = atoi (argv[i])) < 0)
 	ERROR ("invalid time limit");
+    } else if (!strcmp (argv[i], "--backbone")) backbone = true;
+    else if (!strncmp (argv[i], "--phases=", 9)) {
+      if (phases_path) ERROR ("multiple phases files");
+      else phases_path = argv[i] + 9;
+    }
+    else if (!strcmp (argv[i], "--serve")) {
+      if (++i == argc) ERROR ("argument to '--serve' missing");
+      else if (socket_path) ERROR ("multiple sockets");
+      else socket_path = argv[i];
+    } else if (!strcmp (argv[i], "--workers")) {
+      if (++i == argc) ERROR ("argument to '--workers' missing");
+      else if (workers >= 0) ERROR ("multiple number of workers");
+      else if ((workers = atoi (argv[i])) <= 0)
+	ERROR ("invalid number of workers");
     } else if (!strcmp (argv[i], "-n")) set ("--no-witness");
 #ifndef QUIET
     else if (!strcmp (argv[i], "-q")) set ("--quiet");
@@ -160,18 +213,40 @@ int App::main (int argc, char ** argv) {
 #endif
     else if (!strcmp (argv[i], "-c")) set ("--check");
     else if (!strcmp (argv[i], "-f")) set ("--force");
-    else if (set (argv[i])) { /* nothing do be done */ }
+    else if (set (argv[i])) options.push_back (argv[i]);
     else if (argv[i][0] == '-') ERROR ("invalid option '%s'", argv[i]);
     else if (proof_specified) ERROR ("too many arguments");
     else if (dimacs_specified)
           proof_specified = true, proof_path = argv[i];
     else dimacs_specified = true, dimacs_path = argv[i];
   }
+  if (socket_path) {
+    if (dimacs_specified) ERROR ("unexpected DIMACS file in server mode");
+    if (solution_path) ERROR ("unexpected solution file in server mode");
+    if (time_limit >= 0) ERROR ("unexpected time limit in server mode");
+    if (backbone) ERROR ("unexpected '--backbone' in server mode");
+    if (phases_path) ERROR ("unexpected phases file in server mode");
+    if (workers < 0) workers = 4;
+    solver->section ("banner");
+    solver->banner ();
+    solver->section ("serving");
+    solver->message ("serving on '%s' with %d workers",
+      socket_path, workers);
+    if ((err = Server::serve (socket_path, workers, options)))
+      ERROR ("%s", err);
+    solver->message ("stopped serving");
+    goto DONE;
+  }
+  if (workers >= 0) ERROR ("number of workers without '--serve'");
   if (dimacs_specified && dimacs_path && !File::exists (dimacs_path))
     ERROR ("DIMACS input file '%s' does not exist", dimacs_path);
   if (solution_path && !File::exists (solution_path))
     ERROR ("solution file '%s' does not exist", solution_path);
+  if (phases_path && !File::exists (phases_path))
+    ERROR ("phases file '%s' does not exist", phases_path);
   if (solution_path && !solver->get ("check")) set ("--check");
+  if (backbone && proof_specified)
+    ERROR ("can not generate proof while computing backbone");
   solver->section ("banner");
   solver->banner ();
   if (time_limit >= 0) {
@@ -190,6 +265,11 @@ int App::main (int argc, char ** argv) {
     solver->message ("reading solution file from '%s'", solution_path);
     if ((err = solver->solution (solution_path))) ERROR ("%s", err);
   }
+  if (phases_path) {
+    solver->section ("parsing phases");
+    solver->message ("reading phases from '%s'", phases_path);
+    if ((err = solver->phases (phases_path))) ERROR ("%s", err);
+  }
   solver->section ("options");
   solver->options ();
   solver->section ("proof tracing");
@@ -209,20 +289,37 @@ int App::main (int argc, char ** argv) {
       solver->message ("writing %s DRAT proof trace to '%s'",
         (solver->get ("binary") ? "binary" : "non-binary"), proof_path);
   } else solver->message ("will not generate nor write DRAT proof");
-  res = solver->solve ();
-  if (proof_specified) solver->close ();
-  solver->section ("result");
-  if (res == 10) {
-    printf ("s SATISFIABLE\n");
-    fflush (stdout);
-    if (solver->get ("witness")) witness ();
-    fflush (stdout);
-  } else if (res == 20) {
-    printf ("s UNSATISFIABLE\n");
-    fflush (stdout);
+  if (backbone && solver->incremental ())
+    ERROR ("can not compute backbone of incremental CNF");
+  if (backbone) {
+    std::vector<int> lits;
+    res = solver->backbone (lits);
+    solver->section ("result");
+    result (res, &lits);
+  } else if (solver->incremental ()) {
+    solver->section ("incremental solving");
+    long queries = 0;
+    for (;;) {
+      bool assumed;
+      if ((err = solver->query (assumed))) ERROR ("%s", err);
+      if (!assumed) break;
+      res = solver->solve ();
+      printf ("c query %ld\n", ++queries);
+      result (res);
+      if (!res) break;                  // time limit hit or interrupted
+    }
+    solver->message ("solved %ld queries", queries);
+    if (!queries) {
+      res = solver->solve ();
+      solver->section ("result");
+      result (res);
+    }
+    if (proof_specified) solver->close ();
   } else {
-    printf ("c UNKNOWN\n");
-    fflush (stdout);
+    res = solver->solve ();
+    if (proof_specified) solver->close ();
+    solver->section ("result");
+    result (res);
   }
   solver->statistics ();
   solver->message ("exit %d", res);
@@ -1,6 +1,8 @@
 #ifndef _app_hpp_INCLUDED
 #define _app_hpp_INCLUDED
 
+#include <vector>
+
 namespace CaDiCaL {
 
 class Solver;
@@ -23,7 +25,9 @@ class App {
   // Printing.
 
   static void usage ();
+  static void lines (char type, const std::vector<int> & lits);
   static void witness ();
+  static void result (int res, const std::vector<int> * backbone = 0);
   static void banner ();
 
   // Option handling.
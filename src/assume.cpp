@@ -0,0 +1,81 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Assumptions are only valid for the next call to 'solve'.  They are
+// decided first in 'decide' on the lowest decision levels, such that
+// everything else (including learning and restarts) does not need to know
+// about them.  Assumed literals are marked in 'Flags' in order to prevent
+// inprocessing from eliminating or substituting their variables.
+
+void Internal::assume (int lit) {
+  assert (lit);
+  Flags & f = flags (lit);
+  const unsigned char bit = bign (lit);
+  f.assumed |= bit;
+  LOG ("assume %d", lit);
+  assumptions.push_back (lit);
+}
+
+// Called from 'decide' if the assumption 'lit' is falsified.  This final
+// conflict analysis marks all assumptions as failed, which are reached by
+// following the reasons from '-lit' back to the decisions.  All these
+// decisions are assumptions, since we only get here while still deciding
+// assumptions.  Their conjunction together with 'lit' is inconsistent.
+
+void Internal::failing (int lit) {
+  assert (val (lit) < 0);
+  LOG ("analyzing failing assumption %d", lit);
+  flags (lit).failed |= bign (lit);
+  if (!var (lit).level) {
+    LOG ("failing assumption %d falsified on root level", lit);
+    return;
+  }
+  assert (analyzed.empty ());
+  flags (lit).seen = true;
+  analyzed.push_back (-lit);
+  for (size_t i = 0; i < analyzed.size (); i++) {
+    const int other = analyzed[i];
+    assert (val (other) > 0);
+    const Var & v = var (other);
+    assert (v.level > 0);
+    if (!v.reason) {
+      assert (flags (other).assumed & bign (other));
+      LOG ("failed assumption %d", other);
+      flags (other).failed |= bign (other);
+      continue;
+    }
+    Clause * reason = v.reason;
+    if (reason == &atmost_reason) reason = explain_atmost (other);
+    else if (reason == &xor_reason) reason = explain_xor (other);
+    const const_literal_iterator end = reason->end ();
+    const_literal_iterator j;
+    for (j = reason->begin (); j != end; j++) {
+      const int r = *j;
+      if (r == other) continue;
+      assert (val (r) < 0);
+      if (!var (r).level) continue;
+      Flags & f = flags (r);
+      if (f.seen) continue;
+      f.seen = true;
+      analyzed.push_back (-r);
+    }
+  }
+  clear_seen ();
+}
+
+bool Internal::failed (int lit) const {
+  return (flags (lit).failed & bign (lit)) != 0;
+}
+
+void Internal::reset_assumptions () {
+  LOG ("reset %ld assumptions", (long) assumptions.size ());
+  const const_int_iterator end = assumptions.end ();
+  for (const_int_iterator i = assumptions.begin (); i != end; i++) {
+    Flags & f = flags (*i);
+    f.assumed = f.failed = 0;
+  }
+  assumptions.clear ();
+}
+
+};
@@ -0,0 +1,233 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Native cardinality constraints stating that at most 'bound' out of a set
+// of literals are true.  Encoding such a constraint into clauses requires
+// quadratically many binary clauses (for 'bound == 1') or auxiliary
+// variables and clauses linear in the product of the bound and the number
+// of literals (sequential counters or totalizers).  For large constraints
+// this blows up the formula considerably.  Instead we keep them in
+// occurrence lists of their literals and count in each constraint the
+// number of its literals assigned to true on the trail before
+// 'atmost_propagated' (see 'propagate_atmosts').  If the count reaches the
+// bound all other literals are assigned to false.  If it exceeds the bound
+// the constraint is in conflict.  The counts are decreased in 'backtrack'.
+
+// Literals assigned by cardinality constraints get the place holder
+// 'atmost_reason' as reason.  Only if conflict analysis, minimization or
+// the analysis of failed assumptions needs the reason of such a literal, it
+// is replaced by an explanation clause (in 'explain_atmost').  Explanation
+// and conflict clauses are redundant clauses which are immediately marked
+// garbage and not watched.  They are still protected from being collected
+// in 'reduce' as long they are reasons (see 'protect_reasons').
+
+// Cardinality constraints are only propagated during search but not during
+// inprocessing, which thus only works on clauses.  This is sound since the
+// constraints are never removed.  Their variables are frozen (see
+// 'External::add_atmost') and thus are neither eliminated nor substituted.
+// Since learned clauses are not implied by the clauses alone anymore,
+// proofs are not supported.
+
+void Internal::init_atmosts () {
+  assert (!atab);
+  NEW_ZERO (atab, Atmosts, 2*vsize);
+}
+
+void Internal::reset_atmosts () {
+  assert (atab);
+  RELEASE_DELETE (atab, Atmosts, 2*vsize);
+  atab = 0;
+}
+
+void Internal::connect_atmosts () {
+  assert (atab);
+  const const_atmost_iterator end = constraints.end ();
+  const_atmost_iterator i;
+  for (i = constraints.begin (); i != end; i++) {
+    Atmost * a = *i;
+    const const_int_iterator eol = a->lits.end ();
+    const_int_iterator j;
+    for (j = a->lits.begin (); j != eol; j++)
+      atmosts (*j).push_back (a);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Root level assigned literals are removed first (decreasing the bound if
+// true), since after 'compact' all fixed variables are mapped to the same
+// internal variable and thus different literals would collapse.  Then
+// duplicated literals and pairs of complementary literals, of which exactly
+// one is true, are removed.  The caller has to remove duplicated external
+// literals.  Trivial cases are turned into units or a clause, which is also
+// done for 'bound == size - 1', since then at least one literal has to be
+// false.
+
+void Internal::add_atmost (const vector<int> & lits, int bound) {
+
+  assert (!proof);
+  if (level) backtrack ();
+  if (unsat) return;
+
+  assert (clause.empty ());
+  const_int_iterator i;
+  for (i = lits.begin (); i != lits.end (); i++) {
+    const int lit = *i, tmp = val (lit);
+    if (tmp > 0) bound--;
+    else if (!tmp) clause.push_back (lit);
+  }
+  sort (clause.begin (), clause.end (), lit_less_than ());
+  int_iterator j = clause.begin ();
+  int removed = 0;
+  for (i = j; i != clause.end (); i++) {
+    const int lit = *i;
+    if (abs (lit) == removed) continue;
+    if (j != clause.begin () && j[-1] == lit) continue;
+    if (j != clause.begin () && j[-1] == -lit) {
+      removed = abs (lit);
+      j--, bound--;
+      continue;
+    }
+    *j++ = lit;
+  }
+  clause.resize (j - clause.begin ());
+  const int size = (int) clause.size ();
+
+  LOG (clause, "adding cardinality constraint with bound %d on", bound);
+
+  if (bound < 0) {
+    MSG ("cardinality constraint inconsistent with root level units");
+    unsat = true;
+  } else if (bound >= size) {
+    LOG ("trivially satisfied cardinality constraint");
+  } else if (!bound) {
+    LOG ("all literals of cardinality constraint become false");
+    for (i = clause.begin (); i != clause.end (); i++)
+      assign_unit (-*i);
+  } else if (bound == size - 1) {
+    LOG ("cardinality constraint becomes clause");
+    for (j = clause.begin (); j != clause.end (); j++)
+      *j = -*j;
+    add_new_original_clause ();
+  } else {
+    if (!atab) init_atmosts ();
+    stats.atmost.added++;
+    Atmost * a = new Atmost (bound);
+    a->lits = clause;
+    constraints.push_back (a);
+    for (i = clause.begin (); i != clause.end (); i++)
+      atmosts (*i).push_back (a);
+  }
+  clause.clear ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Explanation and conflict clauses are collected in 'explanation' since
+// 'clause' is in use during conflict analysis.
+
+Clause * Internal::new_explanation_clause () {
+  const int size = (int) explanation.size ();
+  assert (size >= 2);
+  swap (clause, explanation);
+  Clause * res = new_clause (true, size);
+  swap (clause, explanation);
+  explanation.clear ();
+  mark_garbage (res);
+  return res;
+}
+
+// The true literal 'lit' has been assigned by some cardinality constraint
+// containing '-lit', which at that point had 'bound' other literals
+// assigned to true before.  It is sufficient to find one such constraint.
+// The explanation clause has 'lit' as first literal, which is required by
+// 'copy_clause' to update the reason after moving the clause.
+
+Clause * Internal::explain_atmost (int lit) {
+  Var & v = var (lit);
+  assert (val (lit) > 0);
+  assert (v.reason == &atmost_reason);
+  assert (explanation.empty ());
+  const Atmosts & as = atmosts (-lit);
+  const const_atmost_iterator end = as.end ();
+  const_atmost_iterator i;
+  for (i = as.begin (); i != end; i++) {
+    const Atmost * a = *i;
+    explanation.push_back (lit);
+    const const_int_iterator eol = a->lits.end ();
+    const_int_iterator j;
+    for (j = a->lits.begin ();
+         j != eol && (int) explanation.size () <= a->bound; j++) {
+      const int other = *j;
+      if (val (other) <= 0) continue;
+      if (var (other).trail > v.trail) continue;
+      explanation.push_back (-other);
+    }
+    if ((int) explanation.size () > a->bound) break;
+    explanation.clear ();
+  }
+  assert (i != end);
+  stats.atmost.explained++;
+  Clause * res = new_explanation_clause ();
+  LOG (res, "explaining %d by", lit);
+  v.reason = res;
+  return res;
+}
+
+// The conflict clause consists of the negation of the 'bound + 1' counted
+// true literals of the constraint.
+
+void Internal::atmost_conflict (Atmost * a) {
+  assert (!conflict);
+  assert (a->count == a->bound + 1);
+  assert (explanation.empty ());
+  const const_int_iterator eol = a->lits.end ();
+  const_int_iterator j;
+  for (j = a->lits.begin (); j != eol; j++) {
+    const int lit = *j;
+    if (val (lit) <= 0) continue;
+    if ((size_t) var (lit).trail >= atmost_propagated) continue;
+    explanation.push_back (-lit);
+  }
+  assert ((int) explanation.size () == a->count);
+  stats.atmost.conflicts++;
+  conflict = new_explanation_clause ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Called from 'compact' on the root level after all literals on the trail
+// have been counted.  Then all constraints are simplified by removing
+// assigned literals.  Constraints with at most 'bound' literals left are
+// satisfied and deleted.  This includes constraints which forced all their
+// remaining literals to false.  The occurrence lists are reset and have to
+// be connected again after mapping the literals.
+
+void Internal::flush_atmosts () {
+  assert (!level);
+  assert (atab);
+  assert (atmost_propagated == trail.size ());
+  const const_atmost_iterator end = constraints.end ();
+  atmost_iterator j = constraints.begin ();
+  const_atmost_iterator i;
+  for (i = j; i != end; i++) {
+    Atmost * a = *i;
+    const const_int_iterator eol = a->lits.end ();
+    int_iterator k = a->lits.begin ();
+    const_int_iterator l;
+    for (l = k; l != eol; l++) {
+      const int lit = *l, tmp = val (lit);
+      if (tmp > 0) a->bound--, a->count--;
+      else if (!tmp) *k++ = lit;
+    }
+    a->lits.resize (k - a->lits.begin ());
+    assert (!a->count), assert (a->bound >= 0);
+    if ((int) a->lits.size () > a->bound) *j++ = a;
+    else delete a;
+  }
+  constraints.resize (j - constraints.begin ());
+  reset_atmosts ();
+}
+
+};
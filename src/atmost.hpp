@@ -0,0 +1,30 @@
+#ifndef _atmost_hpp_INCLUDED
+#define _atmost_hpp_INCLUDED
+
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+// Cardinality constraint stating that at most 'bound' of its literals are
+// true (see 'atmost.cpp').  The 'count' is the number of its literals
+// assigned to true on the trail before 'atmost_propagated'.
+
+struct Atmost {
+  int bound;
+  int count;
+  vector<int> lits;
+  Atmost (int b) : bound (b), count (0) { }
+};
+
+// Occurrence lists of literals in cardinality constraints.
+
+typedef vector<Atmost*> Atmosts;
+
+typedef Atmosts::iterator atmost_iterator;
+typedef Atmosts::const_iterator const_atmost_iterator;
+
+};
+
+#endif
@@ -0,0 +1,150 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Backbone computation in one solver instance, such that learned clauses
+// are kept across all tests.  All variables are frozen during the
+// computation, thus candidates are never eliminated nor substituted.  The
+// candidates are the literals satisfied in the first model.  Then a chunk
+// of candidates is tested by adding the negation of their conjunction as
+// clause with a fresh activation literal, which is assumed (a single
+// candidate is simply assumed negatively instead).  If this is
+// unsatisfiable all candidates in the chunk are backbone literals and the
+// next chunk is twice as large (up to 'backbonechunk').  Otherwise the new
+// model falsifies at least one candidate in the chunk and all falsified
+// candidates are dropped.  Then chunks start again with a single candidate.
+// Before each test the candidates fixed on the root level, which for
+// instance were found by failed literal probing, are moved to the backbone.
+
+// Internal literals change during 'compact'.  Thus the user assumptions
+// are kept as external literals and the activation literal of a chunk is
+// kept in the internal 'guards' while solving, which are mapped.
+
+// Solve under the external user assumptions 'assumed', the activation
+// literals of the pushed groups and core selectors and 'lit' if non-zero.
+
+int External::solve_backbone (const vector<int> & assumed, int lit) {
+  internal->reset_assumptions ();
+  const const_int_iterator end = assumed.end ();
+  for (const_int_iterator i = assumed.begin (); i != end; i++)
+    internal->assume (internalize (*i));
+  activate ();
+  if (lit) internal->assume (lit);
+  internal->budget = Budget ();
+  const int res = internal->solve ();
+  if (res == 10 && internal->opts.check) {
+    extend ();
+    check (&External::val);
+  }
+  return res;
+}
+
+struct backbone_smaller {
+  bool operator () (int a, int b) const { return abs (a) < abs (b); }
+};
+
+int External::backbone (vector<int> & lits) {
+
+  reset_assumptions ();
+  interrupted = false;
+  lits.clear ();
+
+  // Backbone literals are only added as units if they are implied by the
+  // formula alone, i.e., without assumptions, groups and core selectors.
+
+  vector<int> assumed;
+  const const_int_iterator eoa = internal->assumptions.end ();
+  for (const_int_iterator i = internal->assumptions.begin (); i != eoa; i++)
+    assumed.push_back (internal->externalize (*i));
+  const bool conditional =
+    !assumed.empty () || !groups.empty () || !selectors.empty ();
+  LOG ("computing backbone under %ld assumptions and %ld groups",
+    (long) assumed.size (), (long) groups.size ());
+
+  for (int eidx = 1; eidx <= max_var; eidx++) freeze (eidx);
+
+  vector<int> candidates;
+  int res = solve_backbone (assumed, 0);
+  if (res == 10)
+    for (int eidx = 1; eidx <= max_var; eidx++)
+      candidates.push_back (internal->val (e2i[eidx]) < 0 ? -eidx : eidx);
+
+  size_t chunk = 1;
+  while (res == 10) {
+
+    int_iterator j = candidates.begin ();
+    const const_int_iterator end = candidates.end ();
+    for (const_int_iterator i = j; i != end; i++) {
+      const int elit = *i, ilit = internalize (elit);
+      if (internal->fixed (ilit) > 0) {
+        LOG ("backbone candidate %d fixed on root level", elit);
+        lits.push_back (elit);
+      } else *j++ = elit;
+    }
+    candidates.resize (j - candidates.begin ());
+    if (candidates.empty ()) break;
+
+    const size_t size = min (chunk, candidates.size ());
+    const size_t first = candidates.size () - size;
+    int activation = 0, lit;
+    if (size == 1) lit = -internalize (candidates[first]);
+    else {
+      lit = activation = new_activation_variable ();
+      internal->add_original_lit (-activation);
+      for (size_t i = first; i < candidates.size (); i++)
+        internal->add_original_lit (-internalize (candidates[i]));
+      internal->add_original_lit (0);
+    }
+    LOG ("testing chunk of %ld backbone candidates", (long) size);
+    internal->stats.backbone.tests++;
+    if (activation) internal->guards.push_back (activation);
+    res = solve_backbone (assumed, lit);
+    if (activation) {
+      activation = internal->guards.back ();
+      internal->guards.pop_back ();
+    }
+
+    // The model has to be used for filtering before adding clauses below,
+    // since that backtracks to the root level.
+
+    bool implied = false;
+    if (res == 10) {
+      j = candidates.begin ();
+      for (const_int_iterator i = j; i != candidates.end (); i++)
+        if (internal->val (internalize (*i)) > 0) *j++ = *i;
+      LOG ("model drops %ld backbone candidates",
+        (long) (candidates.end () - j));
+      candidates.resize (j - candidates.begin ());
+      chunk = 1;
+    } else if (res == 20) {
+      LOG ("all %ld candidates in chunk are backbone literals", (long) size);
+      if (chunk < (size_t) internal->opts.backbonechunk) chunk *= 2;
+      implied = true;
+      res = 10;
+    }
+
+    if (activation) {
+      internal->add_original_lit (-activation);
+      internal->add_original_lit (0);
+    }
+    if (!implied) continue;
+    for (size_t i = first; i < candidates.size (); i++) {
+      const int elit = candidates[i];
+      lits.push_back (elit);
+      if (conditional) continue;
+      internal->add_original_lit (internalize (elit));
+      internal->add_original_lit (0);
+    }
+    candidates.resize (first);
+  }
+  sort (lits.begin (), lits.end (), backbone_smaller ());
+  internal->stats.backbone.literals += lits.size ();
+  LOG ("found %ld backbone literals", (long) lits.size ());
+
+  for (int eidx = 1; eidx <= max_var; eidx++) melt (eidx);
+  solved = true;
+
+  return res;
+}
+
+};
@@ -13,7 +13,32 @@ inline void Internal::search_unassign (int lit) {
   vals[idx] = 0;
   vals[-idx] = 0;
   LOG ("unassign %d", lit);
-  if (queue.bumped < btab[idx]) update_queue_unassigned (idx);
+  if (scoring) {
+    if (!scores.contains (idx)) scores.push_back (idx);
+  } else if (queue.bumped < btab[idx]) update_queue_unassigned (idx);
+}
+
+// Before backtracking the current assignment is saved as target phases if
+// the trail is larger than the one saved since the last restart and as best
+// phases if it is larger than all saved before (see 'rephase').
+// After a conflict only the trail before the conflict level is conflict
+// free, otherwise the whole trail has been propagated without conflict.
+
+void Internal::update_target_and_best () {
+  const size_t assigned = conflict ? control[level].trail : trail.size ();
+  const bool target = assigned > target_assigned;
+  const bool best = assigned > best_assigned;
+  if (!target && !best) return;
+  for (size_t i = 0; i < assigned; i++) {
+    const int lit = trail[i], idx = vidx (lit);
+    if (target) target_phases[idx] = sign (lit);
+    if (best) best_phases[idx] = sign (lit);
+  }
+  if (target) target_assigned = assigned;
+  if (best) {
+    LOG ("new best assignment of size %ld", (long) assigned);
+    best_assigned = assigned;
+  }
 }
 
 void Internal::backtrack (int target_level) {
@@ -21,13 +46,36 @@ void Internal::backtrack (int target_level) {
   assert (target_level <= level);
   if (target_level == level) return;
   LOG ("backtracking to decision level %d", target_level);
-  int decision = control[target_level + 1].decision, lit;
-  do {
-    assert (!trail.empty ());
-    search_unassign (lit = trail.back ());
+  update_target_and_best ();
+  const size_t assigned = control[target_level + 1].trail;
+  if (atab && atmost_propagated > assigned) {
+    for (size_t i = assigned; i < atmost_propagated; i++) {
+      const Atmosts & as = atmosts (trail[i]);
+      const const_atmost_iterator end = as.end ();
+      for (const_atmost_iterator j = as.begin (); j != end; j++)
+        assert ((*j)->count > 0), (*j)->count--;
+    }
+    atmost_propagated = assigned;
+  }
+  if (xtab && xor_propagated > assigned) {
+    for (size_t i = assigned; i < xor_propagated; i++) {
+      const int lit = trail[i];
+      const Xors & xs = xoccs (lit);
+      const const_xor_iterator end = xs.end ();
+      for (const_xor_iterator j = xs.begin (); j != end; j++) {
+        Xor * x = *j;
+        assert (x->count > 0), x->count--;
+        if (lit > 0) x->sum = !x->sum;
+      }
+    }
+    xor_propagated = assigned;
+  }
+  while (trail.size () > assigned) {
+    search_unassign (trail.back ());
     trail.pop_back ();
-  } while (lit != decision);
+  }
   if (trail.size () < propagated) propagated = trail.size ();
+  projected = 0;
   control.resize (target_level + 1);
   level = target_level;
 }
@@ -0,0 +1,119 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Solving a batch of queries, each given as a set of assumptions.  The
+// literals of each query are sorted by decreasing number of occurrences in
+// all queries and then the queries are sorted lexicographically.  This
+// places queries with long common prefixes next to each other, similar to
+// a depth-first traversal of a trie of all queries.  Since assumptions are
+// decided in order, one per decision level, the levels of the common prefix
+// of the previous and the next query are still valid and the next query
+// just continues the search on the highest of those levels.  This saves
+// re-propagating the shared assumptions, in essence extending the idea of
+// 'reuse_trail' to assumptions.  Learned clauses are shared anyhow.
+
+struct query_literal_smaller {
+  const vector<long> & count;
+  query_literal_smaller (const vector<long> & c) : count (c) { }
+  bool operator () (int a, int b) const {
+    const long s = count[2*abs (a) + (a < 0)], t = count[2*abs (b) + (b < 0)];
+    if (s > t) return true;
+    if (s < t) return false;
+    return a < b;
+  }
+};
+
+struct query_smaller {
+  const vector< vector<int> > & queries;
+  const query_literal_smaller & smaller;
+  query_smaller (const vector< vector<int> > & q,
+                 const query_literal_smaller & s) :
+    queries (q), smaller (s) { }
+  bool operator () (size_t a, size_t b) const {
+    const vector<int> & p = queries[a], & q = queries[b];
+    return lexicographical_compare (p.begin (), p.end (),
+                                    q.begin (), q.end (), smaller);
+  }
+};
+
+void External::solve_batch (const vector< vector<int> > & queries,
+                            vector<int> & results) {
+
+  reset_assumptions ();
+  interrupted = false;
+
+  const size_t n = queries.size ();
+  results.assign (n, 0);
+  LOG ("solving batch of %ld queries", (long) n);
+
+  // Count literal occurrences and freeze all assumed variables, which also
+  // restores eliminated variables once and for all before the first query.
+
+  vector<long> count;
+  vector< vector<int> > sorted (queries);
+  for (size_t i = 0; i < n; i++) {
+    const const_int_iterator end = sorted[i].end ();
+    for (const_int_iterator j = sorted[i].begin (); j != end; j++) {
+      const int lit = *j;
+      assert (lit), assert (lit != INT_MIN);
+      const size_t pos = 2*abs (lit) + (lit < 0);
+      if (pos >= count.size ()) count.resize (pos + 2, 0);
+      count[pos]++;
+      freeze (lit);
+    }
+  }
+
+  const query_literal_smaller smaller (count);
+  vector<size_t> order (n);
+  for (size_t i = 0; i < n; i++) {
+    sort (sorted[i].begin (), sorted[i].end (), smaller);
+    order[i] = i;
+  }
+  sort (order.begin (), order.end (), query_smaller (sorted, smaller));
+
+  // Only the common prefix of the literals of the previous and the next
+  // query is shared.  The activation literals of clause groups and core
+  // selectors are assumed after the query literals as in 'solve', since
+  // 'core' relies on user assumptions being assumed first.
+
+  internal->budget = Budget ();
+  const vector<int> * previous = 0;
+  int res = 0;
+  for (size_t i = 0; i < n; i++) {
+    const size_t idx = order[i];
+    const vector<int> & query = sorted[idx];
+    size_t shared = 0;
+    if (previous) {
+      const size_t size = min (previous->size (), query.size ());
+      while (shared < size && (*previous)[shared] == query[shared])
+        shared++;
+    }
+    LOG ("query %ld shares %ld assumptions with previous query",
+      (long) idx, (long) shared);
+    internal->reset_assumptions ();
+    const const_int_iterator end = query.end ();
+    for (const_int_iterator j = query.begin (); j != end; j++)
+      internal->assume (internalize (*j));
+    activate ();
+    if ((size_t) internal->level > shared) internal->backtrack (shared);
+    res = internal->solve (true);
+    results[idx] = res;
+    if (!res) break;
+    if (res == 10 && internal->opts.check) {
+      extend ();
+      check (&External::val);
+    }
+    previous = &query;
+  }
+  if (res == 10 && !internal->opts.check) extend ();
+
+  for (size_t i = 0; i < n; i++) {
+    const const_int_iterator end = queries[i].end ();
+    for (const_int_iterator j = queries[i].begin (); j != end; j++)
+      melt (*j);
+  }
+  solved = true;
+}
+
+};
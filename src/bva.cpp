@@ -0,0 +1,359 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Bounded variable addition (BVA) as described by Manthey, Heule and Biere
+// in their HVC'12 paper.  It searches for a set of literals 'lits' and a
+// set of clauses 'cls' containing the first of these literals, such that
+// for each clause 'C' in 'cls' and each literal 'l' in 'lits' the clause
+// 'l' with the rest (the 'tail') of 'C' occurs in the formula.  These
+// 'm*n' clauses, where 'm' and 'n' are the sizes of 'lits' and 'cls', are
+// then replaced by 'm+n' clauses using a fresh variable 'x'.  For each
+// literal 'l' in 'lits' the binary clause '-x l' and for each clause 'C'
+// the clause 'x' with the tail of 'C' is added.  This is the reverse of
+// bounded variable elimination and particularly effective on encodings of
+// at-most-one constraints.
+
+// The fresh variable is an internal variable without external counter
+// part (as the activation literals in 'group.cpp').  The original clauses
+// are resolvents on 'x' of the added clauses, thus every model of the new
+// formula is a model of the original formula and no clauses have to be
+// saved on the extension stack.  For the proof the binary clauses are
+// added first, which are RAT on '-x', since no clause contains 'x' yet.
+// The other clauses are RAT on 'x', since their resolvents with the binary
+// clauses are the replaced clauses, which are deleted only afterwards.
+// The proof variable of 'x' is renamed if an external variable with the
+// same index is added later (see 'Proof::relocate').
+
+// Variables without external counter part are never eliminated nor
+// substituted (see 'frozen' and 'decompose.cpp') and clauses containing
+// them are not used in variable elimination (see 'elim_round').
+
+/*------------------------------------------------------------------------*/
+
+// The literal of the tail of 'c' (without 'lit') with the smallest number
+// of occurrences.  All matching clauses have to contain it.
+
+int Internal::bva_tail_literal (Clause * c, int lit) {
+  int res = 0;
+  size_t min = 0;
+  const const_literal_iterator end = c->end ();
+  for (const_literal_iterator i = c->begin (); i != end; i++) {
+    const int other = *i;
+    if (other == lit) continue;
+    const size_t tmp = occs (other).size ();
+    if (res && tmp >= min) continue;
+    res = other;
+    min = tmp;
+  }
+  assert (res);
+  return res;
+}
+
+void Internal::bva_mark_tail (Clause * c, int lit) {
+  const const_literal_iterator end = c->end ();
+  for (const_literal_iterator i = c->begin (); i != end; i++)
+    if (*i != lit) mark (*i);
+}
+
+void Internal::bva_unmark_tail (Clause * c, int lit) {
+  const const_literal_iterator end = c->end ();
+  for (const_literal_iterator i = c->begin (); i != end; i++)
+    if (*i != lit) unmark (*i);
+}
+
+// If 'd' has 'size' literals and contains the marked tail, then return its
+// single unmarked literal and zero otherwise.
+
+int Internal::bva_other_literal (Clause * d, int size) {
+  if (d->garbage || d->size != size) return 0;
+  stats.ticks.bva++;
+  int res = 0;
+  const const_literal_iterator end = d->end ();
+  for (const_literal_iterator i = d->begin (); i != end; i++) {
+    const int other = *i;
+    if (marked (other) > 0) continue;
+    if (res) return 0;
+    res = other;
+  }
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Add and connect 'clause' as irredundant clause.
+
+void Internal::bva_add_clause () {
+  Clause * c = new_resolved_irredundant_clause ();
+  const const_literal_iterator end = c->end ();
+  for (const_literal_iterator i = c->begin (); i != end; i++)
+    occs (*i).push_back (c);
+  clause.clear ();
+}
+
+void Internal::bva_replace (int lit,
+                            const vector<int> & lits,
+                            const vector<Clause*> & cls) {
+
+  // Introduce the fresh variable first, since this might enlarge 'otab'.
+  //
+  const int idx = max_var + 1;
+  init (idx);
+  i2e[idx] = 0;
+  internals++;
+  stats.bva.vars++;
+
+  const long m = lits.size (), n = cls.size ();
+  LOG ("replacing %ld clauses by %ld clauses with new variable %d",
+    m*n, m + n, idx);
+
+  const_int_iterator k;
+  for (k = lits.begin (); k != lits.end (); k++) {
+    clause.push_back (-idx);
+    clause.push_back (*k);
+    bva_add_clause ();
+  }
+
+  const vector<Clause*>::const_iterator eoc = cls.end ();
+  vector<Clause*>::const_iterator i;
+  for (i = cls.begin (); i != eoc; i++) {
+    Clause * c = *i;
+    clause.push_back (idx);
+    const const_literal_iterator end = c->end ();
+    for (const_literal_iterator j = c->begin (); j != end; j++)
+      if (*j != lit) clause.push_back (*j);
+    bva_add_clause ();
+  }
+
+  // Now remove the replaced clauses.  For each clause in 'cls' the clauses
+  // with the other literals in 'lits' are found again through its tail.
+  //
+  for (i = cls.begin (); i != eoc; i++) {
+    Clause * c = *i;
+    bva_mark_tail (c, lit);
+    for (k = lits.begin (); k != lits.end (); k++) {
+      const int other = *k;
+      if (other == lit) continue;
+      const Occs & ds = occs (other);
+      stats.ticks.bva += 1 + cache_lines (ds.size (), sizeof (Clause*));
+      const_occs_iterator j;
+      for (j = ds.begin (); j != ds.end (); j++)
+        if (bva_other_literal (*j, c->size) == other) break;
+      assert (j != ds.end ());
+      if (j == ds.end ()) continue;
+      LOG (*j, "replaced");
+      mark_garbage (*j);
+    }
+    bva_unmark_tail (c, lit);
+    LOG (c, "replaced");
+    mark_garbage (c);
+  }
+
+  stats.bva.reduced += m*n - m - n;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Matches are collected as triples of the literal replacing 'lit', the
+// clause 'c' containing 'lit' and the matching clause 'd'.
+
+struct bva_match {
+  int lit;
+  Clause * c, * d;
+  bva_match (int l, Clause * e, Clause * f) : lit (l), c (e), d (f) { }
+};
+
+struct bva_match_smaller {
+  bool operator () (const bva_match & a, const bva_match & b) {
+    if (a.lit < b.lit) return true;
+    if (a.lit > b.lit) return false;
+    return a.c < b.c;
+  }
+};
+
+struct bva_match_smaller_matching {
+  bool operator () (const bva_match & a, const bva_match & b) {
+    return a.d < b.d;
+  }
+};
+
+struct bva_match_equal_clause {
+  bool operator () (const bva_match & a, const bva_match & b) {
+    return a.c == b.c;
+  }
+};
+
+struct bva_match_equal_matching {
+  bool operator () (const bva_match & a, const bva_match & b) {
+    return a.d == b.d;
+  }
+};
+
+// Greedily extend 'lits' starting with 'lit' by the literal which matches
+// most of the clauses in 'cls', as long as the number of removed clauses
+// increases.  Then replace the clauses if this removes any clause.
+
+bool Internal::bva_literal (int lit) {
+
+  vector<int> lits;
+  vector<Clause*> cls;
+  vector<bva_match> matches;
+
+  lits.push_back (lit);
+  const Occs & os = occs (lit);
+  stats.ticks.bva += 1 + cache_lines (os.size (), sizeof (Clause*));
+  for (const_occs_iterator i = os.begin (); i != os.end (); i++)
+    if (!(*i)->garbage) cls.push_back (*i);
+
+  LOG ("trying bounded variable addition on %d with %ld clauses",
+    lit, (long) cls.size ());
+
+  for (;;) {
+
+    matches.clear ();
+    const vector<Clause*>::const_iterator eoc = cls.end ();
+    vector<Clause*>::const_iterator i;
+    for (i = cls.begin (); i != eoc; i++) {
+      Clause * c = *i;
+      const Occs & ds = occs (bva_tail_literal (c, lit));
+      stats.ticks.bva += 1 + cache_lines (ds.size (), sizeof (Clause*));
+      bva_mark_tail (c, lit);
+      for (const_occs_iterator j = ds.begin (); j != ds.end (); j++) {
+        const int other = bva_other_literal (*j, c->size);
+        if (!other || other == lit || other == -lit) continue;
+        if (find (lits.begin (), lits.end (), other) != lits.end ()) continue;
+        matches.push_back (bva_match (other, c, *j));
+      }
+      bva_unmark_tail (c, lit);
+    }
+
+    // Find the literal with most different matched clauses.
+    //
+    sort (matches.begin (), matches.end (), bva_match_smaller ());
+    int best = 0;
+    long max = 0, count = 0;
+    for (size_t j = 0; j < matches.size (); j++) {
+      if (j && matches[j-1].lit == matches[j].lit) {
+        if (matches[j-1].c != matches[j].c) count++;
+      } else count = 1;
+      if (count > max) best = matches[j].lit, max = count;
+    }
+    if (!best) break;
+
+    // With duplicated clauses the same clause might be matched twice or
+    // match two clauses.  Thus we keep only one match per clause.
+    //
+    size_t k = 0;
+    for (size_t j = 0; j < matches.size (); j++)
+      if (matches[j].lit == best) matches[k++] = matches[j];
+    matches.erase (matches.begin () + k, matches.end ());
+    stable_sort (matches.begin (), matches.end (),
+      bva_match_smaller_matching ());
+    matches.erase (unique (matches.begin (), matches.end (),
+      bva_match_equal_matching ()), matches.end ());
+    sort (matches.begin (), matches.end (), bva_match_smaller ());
+    matches.erase (unique (matches.begin (), matches.end (),
+      bva_match_equal_clause ()), matches.end ());
+    max = matches.size ();
+
+    const long m = lits.size (), n = cls.size ();
+    if ((m + 1)*max - (m + 1) - max <= m*n - m - n) break;
+
+    LOG ("adding %d matching %ld clauses", best, max);
+    lits.push_back (best);
+    cls.clear ();
+    for (size_t j = 0; j < matches.size (); j++)
+      cls.push_back (matches[j].c);
+  }
+
+  const long m = lits.size (), n = cls.size ();
+  if (m*n - m - n <= 0) return false;
+
+  bva_replace (lit, lits, cls);
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+struct bva_less_occs {
+  Internal * internal;
+  bva_less_occs (Internal * i) : internal (i) { }
+  bool operator () (int a, int b) {
+    size_t s = internal->occs (a).size (), t = internal->occs (b).size ();
+    if (s < t) return true;
+    if (s > t) return false;
+    return abs (a) > abs (b);
+  }
+};
+
+// Bounded variable addition works on full occurrence lists of irredundant
+// clauses and is called during 'elim' while watches are disconnected.
+
+void Internal::bva () {
+
+  assert (!unsat);
+  assert (!level);
+  assert (!watches ());
+
+  SWITCH_AND_START (search, simplify, bva);
+  stats.bva.count++;
+
+  // Limit the number of ticks as in 'probe'.
+  //
+  long delta = stats.ticks.search;
+  delta -= lim.search_ticks.bva;
+  delta *= opts.bvareleff;
+  if (delta < opts.bvamineff) delta = opts.bvamineff;
+  if (delta > opts.bvamaxeff) delta = opts.bvamaxeff;
+  long limit = stats.ticks.bva + delta;
+
+  const long old_vars = stats.bva.vars;
+  const long old_reduced = stats.bva.reduced;
+
+  // Connect irredundant clauses without root level assigned literals.
+  // Clauses of pushed groups are not replaced, since they will be popped.
+  //
+  init_occs ();
+  const bool grouping = !external->groups.empty ();
+  const const_clause_iterator eoc = clauses.end ();
+  for (const_clause_iterator i = clauses.begin (); i != eoc; i++) {
+    Clause * c = *i;
+    if (c->garbage || c->redundant) continue;
+    if (grouping && grouped (c)) continue;
+    const const_literal_iterator end = c->end ();
+    const_literal_iterator j;
+    for (j = c->begin (); j != end; j++)
+      if (val (*j)) break;
+    if (j != end) continue;
+    for (j = c->begin (); j != end; j++)
+      occs (*j).push_back (c);
+  }
+
+  // Try literals with many occurrences first and try the same literal
+  // again after a successful replacement.
+  //
+  vector<int> schedule;
+  for (int idx = 1; idx <= max_var; idx++) {
+    if (!active (idx)) continue;
+    if (occs (idx).size () > 1) schedule.push_back (idx);
+    if (occs (-idx).size () > 1) schedule.push_back (-idx);
+  }
+  sort (schedule.begin (), schedule.end (), bva_less_occs (this));
+
+  while (!schedule.empty () && stats.ticks.bva < limit) {
+    const int lit = schedule.back ();
+    schedule.pop_back ();
+    if (bva_literal (lit)) schedule.push_back (lit);
+  }
+
+  reset_occs ();
+  lim.search_ticks.bva = stats.ticks.search;
+
+  VRB ("bva", stats.bva.count,
+    "added %ld variables removing %ld clauses",
+    stats.bva.vars - old_vars, stats.bva.reduced - old_reduced);
+
+  STOP_AND_SWITCH (bva, simplify, search);
+}
+
+};
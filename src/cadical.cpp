@@ -12,12 +12,13 @@ namespace CaDiCaL {
 
 /*------------------------------------------------------------------------*/
 
-Solver::Solver () {
+Solver::Solver () : parser (0), input (0) {
   internal = new Internal ();
   external = new External (internal);
 }
 
 Solver::~Solver () {
+  reset_parser ();
   delete external;
   delete internal;
 }
@@ -42,13 +43,68 @@ bool Solver::set (const char * arg) { return internal->opts.set (arg); }
 /*------------------------------------------------------------------------*/
 
 void Solver::add (int lit) { external->add (lit); }
+void Solver::assume (int lit) { external->assume (lit); }
+
+void Solver::add_atmost (const vector<int> & lits, int bound) {
+  external->add_atmost (lits, bound);
+}
+
+void Solver::add_xor (const vector<int> & lits) {
+  external->add_xor (lits);
+}
+
 int Solver::val (int lit) { return external->val (lit); }
 int Solver::solve () { return external->solve (); }
+int Solver::solve (const Budget & b) { return external->solve (&b); }
+
+void Solver::solve_batch (const vector< vector<int> > & queries,
+                          vector<int> & results) {
+  external->solve_batch (queries, results);
+}
+
+int Solver::backbone (vector<int> & lits) {
+  return external->backbone (lits);
+}
+
+void Solver::core (vector<int> & assumptions, vector<long> & clauses,
+                   bool minimize) {
+  external->core (assumptions, clauses, minimize);
+}
+
+int Solver::optimize (const vector<int> & soft, const vector<long> & weights,
+                      long & cost, Bounder * bounder) {
+  return external->optimize (soft, weights, cost, bounder);
+}
+
+long Solver::enumerate (const vector<int> & projection,
+                        Enumerator * enumerator, long limit) {
+  return external->enumerate (projection, enumerator, limit);
+}
+
+bool Solver::failed (int lit) { return external->failed (lit); }
+
+void Solver::phase (int lit) { external->phase (lit); }
+void Solver::prioritize (int lit) { external->prioritize (lit); }
+
+void Solver::freeze (int lit) { external->freeze (lit); }
+void Solver::melt (int lit) { external->melt (lit); }
+bool Solver::frozen (int lit) { return external->frozen (lit); }
+
+void Solver::push () { external->push (); }
+void Solver::pop () { external->pop (); }
 
 /*------------------------------------------------------------------------*/
 
 void Solver::terminate () { external->terminate (); }
 
+void Solver::connect_terminator (Terminator * terminator) {
+  external->terminator = terminator;
+}
+
+void Solver::connect_learner (Learner * learner) {
+  external->learner = learner;
+}
+
 /*------------------------------------------------------------------------*/
 
 void Solver::close () {
@@ -91,30 +147,45 @@ void Solver::statistics () { internal->stats.print (internal); }
 
 /*------------------------------------------------------------------------*/
 
+// The input file is deleted in 'reset_parser', which for incremental CNF
+// is delayed until the last query is parsed.
+
 const char * Solver::dimacs (File * file) {
-  Parser * parser = new Parser (internal, external, file);
+  reset_parser ();
+  parser = new Parser (internal, external, file);
+  input = file;
   const char * err = parser->parse_dimacs ();
-  delete parser;
+  if (err || !parser->incremental ()) reset_parser ();
   return err;
 }
 
 const char * Solver::dimacs (FILE * external_file, const char * name) {
   File * file = File::read (internal, external_file, name);
   assert (file);
-  const char * err = dimacs (file);
-  delete file;
-  return err;
+  return dimacs (file);
 }
 
 const char * Solver::dimacs (const char * path) {
   File * file = File::read (internal, path);
   if (!file)
     return internal->error.init ("failed to read DIMACS file '%s'", path);
-  const char * err = dimacs (file);
-  delete file;
+  return dimacs (file);
+}
+
+bool Solver::incremental () const { return parser != 0; }
+
+const char * Solver::query (bool & assumed) {
+  assert (parser);
+  const char * err = parser->parse_query (assumed);
+  if (err || !assumed) reset_parser ();
   return err;
 }
 
+void Solver::reset_parser () {
+  if (parser) delete parser, parser = 0;
+  if (input) delete input, input = 0;
+}
+
 File * Solver::output () { return internal->output; }
 
 const char * Solver::solution (const char * path) {
@@ -129,6 +200,17 @@ const char * Solver::solution (const char * path) {
   return err;
 }
 
+const char * Solver::phases (const char * path) {
+  File * file = File::read (internal, path);
+  if (!file)
+    return internal->error.init ("failed to read phases file '%s'", path);
+  Parser * parser = new Parser (internal, external, file);
+  const char * err = parser->parse_phases ();
+  delete parser;
+  delete file;
+  return err;
+}
+
 /*------------------------------------------------------------------------*/
 
 void Solver::section (const char * title) { SECTION (title); }
@@ -30,6 +30,60 @@ namespace CaDiCaL {
 class File;
 class Internal;
 class External;
+class Parser;
+
+/*------------------------------------------------------------------------*/
+
+// Connected terminators are polled regularly during 'solve'.  If 'terminate'
+// returns 'true' the solver stops as if 'Solver::terminate' was called.
+
+class Terminator {
+public:
+  virtual ~Terminator () { }
+  virtual bool terminate () = 0;
+};
+
+// Connected learners receive learned clauses.  First 'learning' is called
+// with the size of the clause and only if it returns 'true' the literals of
+// the clause are given one by one to 'learn' followed by zero.
+
+class Learner {
+public:
+  virtual ~Learner () { }
+  virtual bool learning (int size) = 0;
+  virtual void learn (int lit) = 0;
+};
+
+// Connected enumerators receive the projected models found by 'enumerate'
+// as list of literals, one for each projection variable in the given order.
+// Returning 'false' stops the enumeration.
+
+class Enumerator {
+public:
+  virtual ~Enumerator () { }
+  virtual bool model (const std::vector<int> & lits) = 0;
+};
+
+// Connected bounders receive the lower and upper bound of the cost during
+// 'optimize' whenever one of them improves.  The upper bound is negative
+// as long as no model has been found.
+
+class Bounder {
+public:
+  virtual ~Bounder () { }
+  virtual void bounds (long lower, long upper) = 0;
+};
+
+// Effort budget for one call of 'solve (budget)' with negative values
+// meaning no limit.  These budgets are combined with the 'clim', 'dlim'
+// and 'plim' options (and the smaller limit is used).
+
+struct Budget {
+  long conflicts;
+  long decisions;
+  long propagations;
+  Budget () : conflicts (-1), decisions (-1), propagations (-1) { }
+};
 
 /*------------------------------------------------------------------------*/
 
@@ -38,6 +92,9 @@ class Solver {
   Internal * internal;
   External * external;
 
+  Parser * parser;      // pending incremental CNF parser (see 'query')
+  File * input;         // and its input file
+
 public:
 
   Solver ();
@@ -59,16 +116,156 @@ public:
 
   //------------------------------------------------------------------------
   // Core functionality as in the IPASIR incremental SAT solver interface.
+  // Assumptions are only valid for the next 'solve' and 'failed' can be
+  // used afterwards (until the next 'add', 'assume' or 'solve') to check
+  // which assumptions were used to show unsatisfiability.
 
   void add (int lit);   // add literal, zero to terminate clause
-  int val (int lit);    // get value (-1=false,1=true) of literal
+  void assume (int lit); // assume literal for next 'solve' only
   int solve ();         // returns 10 = SAT, 20 = UNSAT, 0 = UNKNOWN
+  int val (int lit);    // get value (-1=false,1=true) of literal
+  bool failed (int lit); // assumption failed in last 'solve' (if UNSAT)
+
+  // Add the cardinality constraint that at most 'bound' of the literals
+  // (counting duplicates once) are true.  It is propagated natively by
+  // counting true literals instead of being encoded into clauses.  The
+  // variables of the literals are frozen permanently.  Cardinality
+  // constraints can neither be added while groups are pushed, nor do they
+  // have selectors for 'core', nor can they be used together with proofs.
+  //
+  void add_atmost (const std::vector<int> & lits, int bound);
+
+  // Add the parity constraint that an odd number of the literals is true,
+  // e.g., negate one literal for an even number.  It is propagated natively
+  // and used in Gaussian elimination, which also finds parity constraints
+  // encoded in clauses.  Otherwise the same restrictions as for cardinality
+  // constraints apply.
+  //
+  void add_xor (const std::vector<int> & lits);
+
+  // Time-sliced solving.  If the budget is exhausted zero is returned and
+  // the solver keeps its complete state including the trail, such that the
+  // next 'solve (budget)' continues where this one stopped, unless clauses
+  // or assumptions were added in between.  Then it starts from scratch as
+  // the plain 'solve' always does.  Assumptions stay valid while resuming.
+  //
+  int solve (const Budget &);
+
+  // Solve a batch of queries, each given as a list of assumptions, and set
+  // 'results[i]' to the result (10, 20 or 0) of 'queries[i]'.  The queries
+  // are reordered internally such that those with common assumptions are
+  // solved after each other and the trail of the common assumptions is
+  // reused instead of being propagated again.  If the batch is terminated
+  // the remaining results are zero.  Afterwards 'val' and 'failed' refer to
+  // the last solved query only, which is not necessarily the last one.
+  //
+  void solve_batch (const std::vector< std::vector<int> > & queries,
+                    std::vector<int> & results);
+
+  // Enumerate models projected on the given variables (all variables if
+  // empty) under the current assumptions and return how many were found.
+  // At most 'limit' models are enumerated if it is non-negative.  Each
+  // projected model is blocked by the negation of the decisions which led
+  // to it and the search continues without restarting by flipping the
+  // last projection decision.  The blocking clauses are removed afterwards,
+  // thus the formula is not changed, unless '--enumeratekeep' is set.  Then
+  // they are added to the formula permanently and another 'enumerate'
+  // continues with the remaining models.  Since such blocking clauses are
+  // not implied by the formula, 'enumerate' returns -1 without enumerating
+  // any model if '--enumeratekeep' is set while proofs are traced.
+  //
+  long enumerate (const std::vector<int> & projection,
+                  Enumerator * = 0, long limit = -1);
+
+  // Compute the backbone, i.e., the literals true in all models, under the
+  // current assumptions and pushed groups.  Returns 10 and the backbone
+  // literals in the order of their variables if the formula is satisfiable
+  // and 20 if not.  Candidates are taken from a first model and tested in
+  // chunks of increasing size (see '--backbonechunk') with the negation of
+  // their conjunction as temporary clause.  Every further model removes all
+  // candidates it falsifies, and candidates fixed on the root level (e.g.,
+  // by probing) are backbone literals without any test.  Backbone literals
+  // are added as units (without assumptions and groups), thus proofs are
+  // not supported.  If terminated zero is returned and 'lits' contains the
+  // backbone literals found so far.  Afterwards 'val' and 'failed' are
+  // undefined.
+  //
+  int backbone (std::vector<int> & lits);
+
+  // Unsatisfiable core after 'solve' returned 20.  The failed assumptions
+  // are returned in 'assumptions'.  If the 'core' option was enabled while
+  // adding clauses, these clauses are guarded by internal selectors and the
+  // indices of the core clauses (counting all added clauses from zero) are
+  // returned in 'clauses'.  Clauses added without 'core' are always part of
+  // the core implicitly.  With 'minimize' the core is reduced until removing
+  // any single element makes it satisfiable, by solving again under subsets
+  // of the core.  Afterwards 'val' and 'failed' are undefined.  Selected
+  // clauses, like groups, can not be used together with proofs.
+  //
+  void core (std::vector<int> & assumptions, std::vector<long> & clauses,
+             bool minimize = false);
+
+  //------------------------------------------------------------------------
+  // Hints for warm starting from a (near) solution.  The saved phase of the
+  // variable of 'lit' is set to the sign of 'lit', which is used for the
+  // next decision on that variable (and rephasing is delayed).  Prioritized
+  // variables are moved to the front of the decision queue, thus the last
+  // prioritized variable is decided first.  Both hints are kept until
+  // overwritten by the search.  The phases can also be read from a file
+  // with literals as in the 'v' lines of the competition output format.
+
+  void phase (int lit);
+  void prioritize (int lit);
+  const char * phases (const char * path);
+
+  // Minimize the sum of the weights of the falsified soft literals, i.e.,
+  // weighted partial MaxSAT with the added clauses as hard clauses.  Returns
+  // 10 if an optimal model was found, 20 if the hard clauses (under the
+  // current assumptions and groups) are unsatisfiable and 0 if terminated.
+  // Then 'cost' is the cost of the best model found (negative if none) and
+  // 'val' gives this model.  The search is core-guided (OLL) with totalizers
+  // added incrementally for every core and weight stratification, which
+  // finds improving models, i.e., upper bounds, early.  Weights have to be
+  // positive.  The totalizers are removed afterwards, while clauses learned
+  // from the hard clauses are kept.  As for groups proofs are not supported.
+  //
+  int optimize (const std::vector<int> & soft,
+                const std::vector<long> & weights,
+                long & cost, Bounder * = 0);
+
+  //------------------------------------------------------------------------
+  // Variables which are not frozen might be eliminated or substituted during
+  // 'solve'.  If they are used later in 'add', 'assume' or 'freeze' their
+  // clauses have to be restored, which is correct but costly.  Freezing
+  // variables which will be used again avoids this.  Frozen variables are
+  // reference counted and each 'freeze' should be matched by 'melt'.
+
+  void freeze (int lit);
+  void melt (int lit);          // requires that 'lit' is frozen
+  bool frozen (int lit);
+
+  //------------------------------------------------------------------------
+  // Clause groups.  All clauses added after 'push' are removed again by
+  // the matching 'pop' together with the learned clauses depending on them.
+  // Groups can be nested and 'pop' always removes the last pushed group.
+  // This is implemented with internal activation literals and thus avoids
+  // the need of managing selector variables explicitly.  Groups can not be
+  // used together with proofs.
+
+  void push ();
+  void pop ();                  // requires a pushed group
 
   //------------------------------------------------------------------------
   // asynchronous forced termination of 'solve'
 
   void terminate ();
 
+  // Connect or disconnect (with a zero argument) a terminator or learner.
+  // They are not owned by the solver and thus not deleted.
+  //
+  void connect_terminator (Terminator *);
+  void connect_learner (Learner *);
+
   //------------------------------------------------------------------------
 
   const char * version ();	// return version string
@@ -101,17 +298,29 @@ private:
 
   //------------------------------------------------------------------------
   // Used in the stand alone solver application 'App' which in turn uses
-  // 'Signal' for catching signals and printing statistics before aborting.
-  // So only these two classes need access to the otherwise more application
-  // specific functions listed here.
+  // 'Signal' for catching signals and printing statistics before aborting
+  // and 'Server' for serving sessions over a socket.  So only these classes
+  // need access to the otherwise more application specific functions
+  // listed here.
 
   friend class App;
+  friend class Server;
   friend class Signal;
 
   // Read solution in competition format for debugging and testing.
   //
   const char * solution (const char * path);
 
+  // For incremental CNF (iCNF) files with a 'p inccnf' header 'dimacs'
+  // only reads the header and then 'incremental' returns 'true'.  Each
+  // call to 'query' adds the clauses up to the next assumption line
+  // 'a <lit> ... 0' and assumes its literals for the next 'solve'.  It
+  // returns zero if successful (and an error message otherwise) and sets
+  // 'assumed' to 'false' after the last query.
+  //
+  bool incremental () const;
+  const char * query (bool & assumed);
+
   // Messages in a common style.
   //
   void section (const char *);          // standardized section header
@@ -119,6 +328,7 @@ private:
   void error (const char *, ...);       // produce error message
 
   const char * dimacs (File *); // helper function factoring out common code
+  void reset_parser ();         // delete pending parser and input file
   File * output ();             // get access to internal 'output' file
 };
 
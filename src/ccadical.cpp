@@ -1,25 +1,134 @@
 #include "cadical.hpp"
 
+#include <cstdlib>
+#include <cstring>
+
+namespace CaDiCaL {
+
+// The C wrapper object owns the solver and implements both the terminator
+// and the learner interface of the C++ API through the C call-backs.
+
+struct Wrapper : Learner, Terminator {
+
+  Solver * solver;
+
+  struct {
+    void * state;
+    int (*function) (void *);
+  } terminator;
+
+  struct {
+    void * state;
+    int max_length;
+    int * begin_clause, * end_clause, * capacity_clause;
+    void (*function) (void *, int *);
+  } learner;
+
+  bool terminate () {
+    if (!terminator.function) return false;
+    return terminator.function (terminator.state);
+  }
+
+  bool learning (int size) {
+    if (!learner.function) return false;
+    return size <= learner.max_length;
+  }
+
+  void learn (int lit) {
+    if (learner.end_clause == learner.capacity_clause) {
+      size_t count = learner.end_clause - learner.begin_clause;
+      size_t size = count ? 2*count : 1;
+      learner.begin_clause = (int*)
+        realloc (learner.begin_clause, size * sizeof (int));
+      learner.end_clause = learner.begin_clause + count;
+      learner.capacity_clause = learner.begin_clause + size;
+    }
+    *learner.end_clause++ = lit;
+    if (lit) return;
+    learner.function (learner.state, learner.begin_clause);
+    learner.end_clause = learner.begin_clause;
+  }
+
+  Wrapper () : solver (new Solver ()) {
+    memset (&terminator, 0, sizeof terminator);
+    memset (&learner, 0, sizeof learner);
+  }
+
+  ~Wrapper () {
+    if (learner.begin_clause) free (learner.begin_clause);
+    delete solver;
+  }
+};
+
+};
+
 using namespace CaDiCaL;
 
 extern "C" {
 
 #include "ccadical.h"
 
-CCaDiCaL * ccadical_init () { return (CCaDiCaL*) new Solver (); }
-void ccadical_reset (CCaDiCaL * solver) { delete (Solver*) solver; }
+CCaDiCaL * ccadical_init () { return (CCaDiCaL*) new Wrapper (); }
+void ccadical_reset (CCaDiCaL * wrapper) { delete (Wrapper*) wrapper; }
 
-void ccadical_add (CCaDiCaL * solver, int lit) {
-  ((Solver*) solver)->add (lit);
+void ccadical_add (CCaDiCaL * wrapper, int lit) {
+  ((Wrapper*) wrapper)->solver->add (lit);
 }
 
-int ccadical_sat (CCaDiCaL * solver) {
-  return ((Solver*) solver)->solve ();
+void ccadical_assume (CCaDiCaL * wrapper, int lit) {
+  ((Wrapper*) wrapper)->solver->assume (lit);
 }
 
-int ccadical_deref (CCaDiCaL * solver, int lit) {
-  return ((Solver*) solver)->val (lit);
+int ccadical_sat (CCaDiCaL * wrapper) {
+  return ((Wrapper*) wrapper)->solver->solve ();
 }
 
-};
+int ccadical_deref (CCaDiCaL * wrapper, int lit) {
+  return ((Wrapper*) wrapper)->solver->val (lit);
+}
 
+int ccadical_failed (CCaDiCaL * wrapper, int lit) {
+  return ((Wrapper*) wrapper)->solver->failed (lit);
+}
+
+void ccadical_freeze (CCaDiCaL * wrapper, int lit) {
+  ((Wrapper*) wrapper)->solver->freeze (lit);
+}
+
+void ccadical_melt (CCaDiCaL * wrapper, int lit) {
+  ((Wrapper*) wrapper)->solver->melt (lit);
+}
+
+int ccadical_frozen (CCaDiCaL * wrapper, int lit) {
+  return ((Wrapper*) wrapper)->solver->frozen (lit);
+}
+
+void ccadical_push (CCaDiCaL * wrapper) {
+  ((Wrapper*) wrapper)->solver->push ();
+}
+
+void ccadical_pop (CCaDiCaL * wrapper) {
+  ((Wrapper*) wrapper)->solver->pop ();
+}
+
+void ccadical_set_terminate (CCaDiCaL * ptr,
+                             void * state, int (*terminate)(void *)) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  wrapper->terminator.state = state;
+  wrapper->terminator.function = terminate;
+  if (terminate) wrapper->solver->connect_terminator (wrapper);
+  else wrapper->solver->connect_terminator (0);
+}
+
+void ccadical_set_learn (CCaDiCaL * ptr,
+                         void * state, int max_length,
+                         void (*learn)(void * state, int * clause)) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  wrapper->learner.state = state;
+  wrapper->learner.max_length = max_length;
+  wrapper->learner.function = learn;
+  if (learn) wrapper->solver->connect_learner (wrapper);
+  else wrapper->solver->connect_learner (0);
+}
+
+};
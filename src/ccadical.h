@@ -1,7 +1,7 @@
 #ifndef _ccadical_h_INCLUDED
 #define _ccadical_h_INCLUDED
 
-// C wrapper for CaDiCaL's C++ API
+// C wrapper for CaDiCaL's C++ API following IPASIR.
 
 typedef struct CCaDiCaL CCaDiCaL;
 
@@ -9,7 +9,22 @@ CCaDiCaL * ccadical_init ();
 void ccadical_reset (CCaDiCaL *);
 
 void ccadical_add (CCaDiCaL *, int lit);
+void ccadical_assume (CCaDiCaL *, int lit);
 int ccadical_sat (CCaDiCaL *);
 int ccadical_deref (CCaDiCaL *, int lit);
+int ccadical_failed (CCaDiCaL *, int lit);
+
+void ccadical_freeze (CCaDiCaL *, int lit);
+void ccadical_melt (CCaDiCaL *, int lit);
+int ccadical_frozen (CCaDiCaL *, int lit);
+
+void ccadical_push (CCaDiCaL *);
+void ccadical_pop (CCaDiCaL *);
+
+void ccadical_set_terminate (CCaDiCaL *,
+  void * state, int (*terminate)(void * state));
+
+void ccadical_set_learn (CCaDiCaL *,
+  void * state, int max_length, void (*learn)(void * state, int * clause));
 
 #endif
@@ -103,15 +103,16 @@ Clause * Internal::new_clause (bool red, int glue) {
   else keep = false;
 
   // Determine whether this clauses is extended and uses a '_pos' field.
+  // Learned clauses which are not kept also need the 'used_at' field.
   //
-  bool extended = (size >= opts.posize);
+  bool extended = (size >= opts.posize) || !keep;
 
   // Now allocate the clause after ignored the 'offset' bytes, if '_pos' or
   // 'analyzed' fields are not used.
   //
   Clause * c;
   size_t offset = 0;
-  if (!extended) offset += sizeof c->_pos + sizeof c->alignment;
+  if (!extended) offset += sizeof c->_pos + sizeof c->used_at;
   size_t bytes = sizeof (Clause) + (size - 2) * sizeof (int) - offset;
   bytes = align (bytes, 8);
   char * ptr = new char[bytes];
@@ -119,7 +120,7 @@ Clause * Internal::new_clause (bool red, int glue) {
   ptr -= offset;
   c = (Clause*) ptr;
 
-  if (extended) c->_pos = 2, c->alignment = 0;
+  if (extended) c->_pos = 2, c->used_at = stats.conflicts;
   c->extended = extended;
   c->redundant = red;
   c->keep = keep;
@@ -293,25 +294,54 @@ bool Internal::tautological_clause () {
 
 // New clause added through the API, e.g., while parsing a DIMACS file.
 // Assume the clause has been simplified and checked with
-// 'tautological_clause' before.
+// 'tautological_clause' before.  Clauses might also be added after 'solve'
+// (incremental usage), where root level assignments are already propagated
+// and thus have to be taken into account here.  So we first backtrack to
+// the root level, skip root level satisfied clauses and remove root level
+// falsified literals.  If all literals are falsified the clause is treated
+// as a clashing unit which ensures that the empty clause is traced.
 //
 void Internal::add_new_original_clause () {
+  if (level) backtrack ();
   stats.original++;
-  int size = (int) clause.size ();
+  const const_int_iterator end = clause.end ();
+  const_int_iterator i;
+  int_iterator j = clause.begin ();
+  for (i = j; i != end; i++) {
+    const int lit = *i, tmp = val (lit);
+    if (tmp > 0) break;
+    if (tmp < 0) continue;
+    *j++ = lit;
+  }
+  if (i != end) {
+    LOG ("root level satisfied original clause");
+    return;
+  }
+  int size = (int) (j - clause.begin ());
+  if (j != end) {
+    LOG ("removing %ld root level falsified literals",
+      (long) (end - j));
+    if (!size) {
+      if (!unsat) {
+        MSG ("parsed clause clashing with root level units");
+        clashing = true;
+      } else LOG ("original clashing clause produces another inconsistency");
+      return;
+    }
+    clause.resize (size);
+    if (proof && size > 1) proof->trace_add_clause ();
+  }
   if (!size) {
     if (!unsat) {
       MSG ("original empty clause");
       unsat = true;
     } else LOG ("original empty clause produces another inconsistency");
   } else if (size == 1) {
-    int unit = clause[0], tmp = val (unit);
-    if (!tmp) assign_unit (unit);
-    else if (tmp < 0) {
-      if (!unsat) {
-        MSG ("parsed clashing unit");
-        clashing = true;
-      } else LOG ("original clashing unit produces another inconsistency");
-    } else LOG ("original redundant unit");
+    // Root level assigned units are traced in 'learn_unit_clause', which
+    // also covers clauses reduced to a unit by falsified literals above.
+    //
+    assert (!level);
+    assign_unit (clause[0]);
   } else watch_clause (new_clause (false));
 }
 
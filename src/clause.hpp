@@ -40,7 +40,8 @@ typedef const int *                      const_literal_iterator;
 //   contains  the position of the last exchanged watch in a long clause.
 //   This field is only present if 'extended' is true.  Saving in '_pos'
 //   starts making sense for clauses of length 4 and we usually have
-//   'opts.keepsize == 3'.
+//   'opts.keepsize == 3'.  Redundant clauses which are not kept are always
+//   extended, since they need the 'used_at' field (see 'reduce.cpp').
 //
 // With these three optimizations a binary clause only needs 16 bytes
 // instead of 44 bytes.  The last two optimizations reduce memory usage of
@@ -72,11 +73,13 @@ public:
   // Keep start of clause and 'copy' field (and thus 'literals[0]' at 64-bit
   // aligned offsets, no matter whether we have a '_pos' field or not.
   // Otherwise a binary clause does not have 16 bytes.  Keeping clauses at
-  // 64-bit aligned addresses gives around 5% speed improvement.
+  // 64-bit aligned addresses gives around 5% speed improvement.  These four
+  // bytes are used to store the (truncated) conflict number of the last
+  // use of a learned clause in conflict analysis.
   //
-  int alignment;    // unused four bytes alignment
+  unsigned used_at; // conflict of last use (if 'extended')
 
-  bool extended : 1;	// has this '_pos' field (and 'dummy')
+  bool extended : 1;	// has this '_pos' field (and 'used_at')
 
   bool redundant:1; // aka 'learned' so not 'irredundant' (original)
   bool keep : 1;    // always keep this clause (if redundant)
@@ -150,7 +153,7 @@ struct smaller_size {
 
 inline size_t Clause::offset () const {
   size_t res = 0;
-  if (!extended) res += sizeof _pos + sizeof alignment;
+  if (!extended) res += sizeof _pos + sizeof used_at;
   assert (aligned (res, 8));
   return res;
 }
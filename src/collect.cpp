@@ -350,6 +350,8 @@ void Internal::garbage_collection () {
   START (collect);
   report ('G', 1);
   stats.collections++;
+  lim.popped_groups_at_last_collect = stats.popped.groups;
+  lim.popped_clauses_at_last_collect = stats.popped.clauses;
   mark_satisfied_clauses_as_garbage ();
   if (arenaing ()) copy_non_garbage_clauses ();
   else delete_garbage_clauses ();
@@ -173,6 +173,14 @@ void Internal::compact () {
 
   const int first_fixed_val = first_fixed ? val (first_fixed) : 0;
 
+  // Fixed internal variables without external counter part are removed
+  // from the proof too (see 'Proof::trace_delete_unit_clause').
+  //
+  if (proof)
+    for (int src = 1; src <= max_var; src++)
+      if (!map[src] && !i2e[src] && i2p[src] && flags (src).fixed ())
+        proof->trace_delete_unit_clause (val (src) < 0 ? -src : src);
+
   if (first_fixed)
     LOG ("found first fixed %d", sign (first_fixed_val)*first_fixed);
   else LOG ("no variable fixed");
@@ -199,6 +207,92 @@ void Internal::compact () {
 
   PRINT ("mapped 'i2e'");
 
+  // Map the activation literals of pushed groups.
+  {
+    vector<Group> & groups = external->groups;
+    const vector<Group>::iterator end = groups.end ();
+    vector<Group>::iterator i;
+    for (i = groups.begin (); i != end; i++) {
+      MAP_LIT (i->activation, i->activation);
+      assert (i->activation);
+    }
+  }
+
+  PRINT ("mapped 'groups'");
+
+  // Map the activation literals of core selectors.
+  {
+    vector<Selector> & selectors = external->selectors;
+    const vector<Selector>::iterator end = selectors.end ();
+    vector<Selector>::iterator i;
+    for (i = selectors.begin (); i != end; i++) {
+      MAP_LIT (i->activation, i->activation);
+      assert (i->activation);
+    }
+  }
+
+  PRINT ("mapped 'selectors'");
+
+  // Map the assumptions (which might also be root level fixed).
+  {
+    const const_int_iterator end = assumptions.end ();
+    int_iterator i;
+    for (i = assumptions.begin (); i != end; i++) {
+      MAP_LIT (*i, *i);
+      assert (*i);
+    }
+  }
+
+  PRINT ("mapped 'assumptions'");
+
+  // Same for the projection variables during 'enumerate'.
+  {
+    const const_int_iterator end = projection.end ();
+    int_iterator i;
+    for (i = projection.begin (); i != end; i++) {
+      MAP_LIT (*i, *i);
+      assert (*i);
+    }
+  }
+
+  PRINT ("mapped 'projection'");
+
+  // And the soft literals during 'optimize'.
+  {
+    const const_int_iterator end = objective.end ();
+    int_iterator i;
+    for (i = objective.begin (); i != end; i++) {
+      MAP_LIT (*i, *i);
+      assert (*i);
+    }
+  }
+
+  PRINT ("mapped 'objective'");
+
+  // And the activation literals of 'backbone' and 'optimize'.
+  {
+    const const_int_iterator end = guards.end ();
+    int_iterator i;
+    for (i = guards.begin (); i != end; i++) {
+      MAP_LIT (*i, *i);
+      assert (*i);
+    }
+  }
+
+  PRINT ("mapped 'guards'");
+
+  // And the totalizer outputs during 'optimize'.
+  {
+    const const_int_iterator end = outputs.end ();
+    int_iterator i;
+    for (i = outputs.begin (); i != end; i++) {
+      MAP_LIT (*i, *i);
+      assert (*i);
+    }
+  }
+
+  PRINT ("mapped 'outputs'");
+
   // Map the literals in all clauses.
   {
     const const_clause_iterator end = clauses.end ();
@@ -221,6 +315,41 @@ void Internal::compact () {
 
   PRINT ("mapped 'clauses'");
 
+  // Map the literals in cardinality constraints after flushing assigned
+  // literals, which also disconnects their occurrence lists.
+  if (atab) {
+    flush_atmosts ();
+    const const_atmost_iterator end = constraints.end ();
+    const_atmost_iterator i;
+    for (i = constraints.begin (); i != end; i++) {
+      Atmost * a = *i;
+      const const_int_iterator eol = a->lits.end ();
+      int_iterator j;
+      for (j = a->lits.begin (); j != eol; j++) {
+	MAP_LIT (*j, *j);
+	assert (*j);
+      }
+    }
+  }
+
+  // Same for the variables in parity constraints.
+  if (xtab) {
+    flush_xors ();
+    const const_xor_iterator end = xors.end ();
+    const_xor_iterator i;
+    for (i = xors.begin (); i != end; i++) {
+      Xor * x = *i;
+      const const_int_iterator eol = x->vars.end ();
+      int_iterator j;
+      for (j = x->vars.begin (); j != eol; j++) {
+	MAP_LIT (*j, *j);
+	assert (*j > 0);
+      }
+    }
+  }
+
+  PRINT ("mapped 'constraints'");
+
   // Map the blocking literals in all watches.
   //
   if (watches ()) {
@@ -265,7 +394,8 @@ void Internal::compact () {
   /*----------------------------------------------------------------------*/
 
   MAP_AND_FLUSH_INT_VECTOR (trail);
-  propagated = trail.size ();
+  propagated = atmost_propagated = xor_propagated = trail.size ();
+  target_assigned = best_assigned = 0;
   if (first_fixed) {
     assert (trail.size () == 1);
     var (first_fixed).trail = 0;		// before mapping 'vtab'
@@ -283,6 +413,8 @@ void Internal::compact () {
   MAP_ARRAY_ONLY (Flags, ftab);
   MAP_ARRAY_ONLY (signed_char, marks);
   MAP_ARRAY_ONLY (signed_char, phases);
+  MAP_ARRAY_ONLY (signed_char, target_phases);
+  MAP_ARRAY_ONLY (signed_char, best_phases);
 
 #if 1
   // Special case for 'val' as always since for 'val' we trade branch less
@@ -306,7 +438,12 @@ void Internal::compact () {
   PRINT ("mapped 'vals'");
 
   MAP_ARRAY_ONLY (int, i2e);
+  internals = 0;
+  for (int idx = 1; idx <= new_max_var; idx++)
+    if (!i2e[idx]) internals++;
+  MAP_ARRAY_ONLY (int, i2p);
   MAP2_ARRAY_ONLY (int, ptab);
+  MAP_ARRAY_ONLY (double, stab);
   MAP_ARRAY_ONLY (long, btab);
   if (ntab2) MAP_ARRAY_ONLY (long, ntab2);
   MAP_ARRAY_ONLY (Link, ltab);
@@ -341,6 +478,16 @@ void Internal::compact () {
 
   PRINT ("mapped 'esched'");
 
+  // The EVSIDS heap is simply rebuilt, since all variables except for
+  // 'first_fixed' are unassigned and scores have been mapped already.
+  //
+  if (scoring) {
+    scores.clear ();
+    for (int idx = 1; idx <= new_max_var; idx++)
+      if (!vals[idx]) scores.push_back (idx);
+    scores.shrink ();
+  }
+
   /*----------------------------------------------------------------------*/
 
   DELETE_ONLY (map, int, max_var);
@@ -352,6 +499,9 @@ void Internal::compact () {
   max_var = new_max_var;
   vsize = new_vsize;
 
+  if (!constraints.empty ()) init_atmosts (), connect_atmosts ();
+  if (!xors.empty ()) init_xors (), connect_xors ();
+
   stats.now.fixed = first_fixed ? 1 : 0;
   stats.now.substituted = stats.now.eliminated = 0;
 
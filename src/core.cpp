@@ -0,0 +1,94 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Unsatisfiable cores of original clauses use selector literals, i.e.,
+// every clause added while the 'core' option is enabled gets the negation
+// of a fresh activation literal added, which in turn is assumed in every
+// 'solve' (see 'activate').  Since selectors only occur negatively, the
+// failed selectors after an unsatisfiable 'solve' select a subset of the
+// clauses, which together with the clauses added without 'core' is
+// unsatisfiable (under the failed assumptions).  Selected clauses are not
+// eliminated, since activation literals are internal (see 'elim_round').
+
+void External::select () {
+  const int selector = new_activation_variable ();
+  LOG ("adding selector literal %d of clause %ld", -selector, clauses);
+  internal->add_original_lit (-selector);
+  selectors.push_back (Selector (selector, clauses));
+}
+
+// The initial core consists of the failed user assumptions and selectors
+// of the last 'solve'.  Deletion based minimization then removes one core
+// element after the other and solves again under the remaining elements.
+// If this is still unsatisfiable the removed element is not needed and the
+// core shrinks to the failed remaining elements, which is also called
+// clause set refinement.  Otherwise the element is necessary.  All these
+// calls share the learned clauses of the same solver.
+
+// Core elements are tagged by twice their external literal for user
+// assumptions and by twice the position of their selector plus one.
+
+int External::core_literal (long tag) {
+  if (tag & 1) return selectors[tag / 2].activation;
+  return internalize (tag / 2);
+}
+
+void External::core (vector<int> & eassumptions, vector<long> & ids,
+                     bool minimize) {
+
+  eassumptions.clear ();
+  ids.clear ();
+  if (!solved || internal->unsat) return;
+
+  // Assumptions are ordered as user assumptions, then group activation
+  // literals and finally core selectors.
+
+  const vector<int> & assumptions = internal->assumptions;
+  const size_t activated = groups.size () + selectors.size ();
+  if (assumptions.size () < activated) return;
+  const size_t users = assumptions.size () - activated;
+
+  vector<long> tags;            // twice external literal or '2*pos + 1'
+  for (size_t i = 0; i < assumptions.size (); i++) {
+    const int lit = assumptions[i];
+    if (!internal->failed (lit)) continue;
+    if (i < users) tags.push_back (2l * internal->externalize (lit));
+    else if (i < users + groups.size ()) continue;
+    else tags.push_back (2l * (i - users - groups.size ()) + 1);
+  }
+  LOG ("initial core of %ld elements", (long) tags.size ());
+
+  // Internal literals change during 'compact', thus the internal literals
+  // of the remaining core elements are obtained from their tags before and
+  // after every call to 'solve'.
+
+  for (size_t i = 0; minimize && i < tags.size (); ) {
+    LOG ("trying to remove core element %ld", tags[i]);
+    internal->stats.core.tests++;
+    internal->reset_assumptions ();
+    for (size_t j = 0; j < tags.size (); j++)
+      if (i != j) internal->assume (core_literal (tags[j]));
+    const vector<Group>::const_iterator end = groups.end ();
+    for (vector<Group>::const_iterator g = groups.begin (); g != end; g++)
+      internal->assume (g->activation);
+    internal->budget = Budget ();
+    const int res = internal->solve ();
+    if (!res) break;
+    if (res == 10) { i++; continue; }
+    size_t k = 0;
+    for (size_t j = 0; j < tags.size (); j++)
+      if (i != j && internal->failed (core_literal (tags[j])))
+        tags[k++] = tags[j];
+    LOG ("removed %ld core elements", (long) (tags.size () - k));
+    internal->stats.core.removed += tags.size () - k;
+    tags.resize (k);
+  }
+  if (minimize) internal->reset_assumptions (), solved = false;
+
+  for (size_t i = 0; i < tags.size (); i++)
+    if (tags[i] & 1) ids.push_back (selectors[tags[i] / 2].id);
+    else eassumptions.push_back (tags[i] / 2);
+}
+
+};
@@ -7,11 +7,20 @@ namespace CaDiCaL {
 // without any assignment will return the same result.  This is of course
 // used below in 'decide' but also in 'reuse_trail' to determine the largest
 // decision level to backtrack to during 'restart' without changing the
-// assigned variables.
+// assigned variables.  With EVSIDS scores (see 'score.cpp') assigned
+// variables are popped from the top of the heap instead.
 
 int Internal::next_decision_variable () {
   long searched = 0;
-  int res = queue.unassigned;
+  int res;
+  if (scoring) {
+    while (val (res = scores.front ()))
+      scores.pop_front (), searched++;
+    stats.searched += searched;
+    LOG ("next decision variable %d with score %g", res, score (res));
+    return res;
+  }
+  res = queue.unassigned;
   while (val (res))
     res = link (res).prev, searched++;
   if (searched) {
@@ -22,27 +31,84 @@ int Internal::next_decision_variable () {
   return res;
 }
 
+// During 'enumerate' the projection variables are decided before all other
+// variables.  Thus as soon a model is found, the decisions on the levels up
+// to the last projection variable determine the projected model completely
+// (see 'block_projected_model').  The position 'projected' is only reset
+// during backtracking, since all projection variables before it are still
+// assigned otherwise.
+
+int Internal::next_projected_variable () {
+  while (projected < projection.size ()) {
+    const int idx = vidx (projection[projected]);
+    if (!val (idx)) {
+      LOG ("next projected decision variable %d", idx);
+      return idx;
+    }
+    projected++;
+  }
+  return 0;
+}
+
 // Just assume the given literal as decision (increase decision level and
 // assign it).  This is used below in 'decide' and in failed literal
 // probing to assign the next 'probe'.
 
 void Internal::assume_decision (int lit) {
   level++;
-  control.push_back (Level (lit));
+  control.push_back (Level (lit, trail.size ()));
   LOG ("decide %d", lit);
   assign_decision (lit);
 }
 
-// Search for the next decision and assign it to the saved phase.  Requires
-// that not all variables are assigned.
+// In stable mode (or always if 'target > 1') decisions follow the target
+// phases, which are the largest conflict free assignment since the last
+// restart (see 'update_target_and_best').  Otherwise, and for variables
+// without target phase, the saved phase is used.
 
-void Internal::decide () {
+int Internal::decide_phase (int idx) {
+  signed char phase = 0;
+  if (opts.target > 1 || (opts.target && stable))
+    phase = target_phases[idx];
+  if (!phase) phase = phases[idx];
+  return phase * idx;
+}
+
+// Search for the next decision and assign it to its phase.  Requires
+// that not all variables are assigned.  Assumptions are decided first, one
+// on each of the lowest decision levels.  If an assumption is already
+// satisfied we only open a pseudo decision level for it, and if it is
+// falsified, the formula is unsatisfiable under the given assumptions,
+// which is signalled by returning '20' after determining the failed
+// assumptions in 'failing'.
+
+int Internal::decide () {
   START (decide);
-  stats.decisions++;
-  int idx = next_decision_variable ();
-  int decision = phases[idx] * idx;
-  assume_decision (decision);
+  int res = 0;
+  if ((size_t) level < assumptions.size ()) {
+    const int lit = assumptions[level], tmp = val (lit);
+    if (tmp < 0) {
+      LOG ("assumption %d falsified", lit);
+      failing (lit);
+      res = 20;
+    } else if (tmp > 0) {
+      level++;
+      control.push_back (Level (0, trail.size ()));
+      LOG ("pseudo decision level %d for satisfied assumption %d",
+        level, lit);
+    } else {
+      stats.decisions++;
+      LOG ("deciding assumption %d", lit);
+      assume_decision (lit);
+    }
+  } else {
+    stats.decisions++;
+    int idx = next_projected_variable ();
+    if (!idx) idx = next_decision_variable ();
+    assume_decision (decide_phase (idx));
+  }
   STOP (decide);
+  return res;
 }
 
 };
@@ -7,6 +7,7 @@ namespace CaDiCaL {
 // are equivalent and we replace them all by the literal with the smallest
 // index in an scc.  This variables are marked 'substituted' and will be
 // removed from all clauses.  Their value will be fixed during 'extend'.
+// Frozen variables are kept as their own representative.
 
 #define TRAVERSED UINT_MAX              // mark completely traversed
 
@@ -98,9 +99,11 @@ bool Internal::decompose_round () {
 
               // All nodes on the 'scc' stack after and including 'parent'
               // are in the same scc.  Their representative is computed as
-              // the smallest literal (index-wise) in the SCC.  If the SCC
-              // contains both a literal and its negation, then the formula
-              // becomes unsatisfiable.
+              // the smallest literal (index-wise) in the SCC, preferring
+              // literals with external counter part, since substituted
+              // literals are saved on the extension stack in external form.
+              // If the SCC contains both a literal and its negation, then
+              // the formula becomes unsatisfiable.
 
               int other, size = 0, repr = parent;
               assert (!scc.empty ());
@@ -113,7 +116,10 @@ bool Internal::decompose_round () {
                   assign_unit (parent);
                   learn_empty_clause ();
                 } else {
-                  if (abs (other) < abs (repr)) repr = other;
+                  const bool internal_only = !externalize (repr);
+                  if (externalize (other) &&
+                      (internal_only || abs (other) < abs (repr)))
+                    repr = other;
                   size++;
                 }
               } while (!unsat && other != parent);
@@ -127,8 +133,11 @@ bool Internal::decompose_round () {
                   other = scc.back ();
                   scc.pop_back ();
                   dfs[vlit (other)].min = TRAVERSED;
-                  reprs[vlit (other)] = repr;
-                  if (other != repr) {
+                  if (frozen (other)) {
+                    LOG ("frozen literal %d not substituted", other);
+                    reprs[vlit (other)] = other;
+                  } else reprs[vlit (other)] = repr;
+                  if (reprs[vlit (other)] != other) {
                     substituted++;
                     LOG ("literal %d in scc of %d", other, repr);
                   }
@@ -312,7 +321,11 @@ bool Internal::decompose_round () {
 
   // Finally, mark substituted literals as such and push the equivalences of
   // the substituted literals to their representative on the extension
-  // stack to fix an assignment during 'extend'.
+  // stack to fix an assignment during 'extend'.  This includes literals
+  // with a representative which became fixed, since otherwise they would
+  // stay active and could be used again in later incremental calls, while
+  // 'extend' still overwrites their value.  Marked as substituted their
+  // equivalence is restored instead (see 'restore.cpp').
 
   for (int idx = 1; !unsat && idx <= max_var; idx++) {
     if (!active (idx)) continue;
@@ -320,18 +333,19 @@ bool Internal::decompose_round () {
     if (other == idx) continue;
     assert (!flags (other).eliminated ());
     assert (!flags (other).substituted ());
-    if (!flags (other).fixed ()) {
-      assert (active (other));
-      flags (idx).status = Flags::SUBSTITUTED;
-      stats.all.substituted++;
-      stats.now.substituted++;
-    }
+    assert (active (other) || flags (other).fixed ());
+    flags (idx).status = Flags::SUBSTITUTED;
+    mark_garbage_xors (idx);
+    stats.all.substituted++;
+    stats.now.substituted++;
     external->push_binary_on_extension_stack (-idx, other);
     external->push_binary_on_extension_stack (idx, -other);
   }
 
   delete [] reprs;
 
+  delete_garbage_xors ();
+
   flush_all_occs_and_watches ();  // particularly the 'blit's
   report ('d');
 
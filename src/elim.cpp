@@ -48,6 +48,7 @@ bool Internal::eliminating () {
 
 inline void Internal::elim_update_added (Clause * c) {
   assert (!c->redundant);
+  stats.ticks.elim += c->size;
   const const_literal_iterator end = c->end ();
   const_literal_iterator i;
   for (i = c->begin (); i != end; i++) {
@@ -68,6 +69,7 @@ inline void Internal::elim_update_added (Clause * c) {
 
 inline void Internal::elim_update_removed (Clause * c, int except) {
   assert (!c->redundant);
+  stats.ticks.elim += c->size;
   const const_literal_iterator end = c->end ();
   const_literal_iterator i;
   for (i = c->begin (); i != end; i++) {
@@ -103,6 +105,7 @@ inline void Internal::elim_update_removed (Clause * c, int except) {
 bool Internal::resolve_clauses (Clause * c, int pivot, Clause * d) {
 
   stats.elimres++;
+  stats.ticks.elim++;
 
   if (c->garbage || d->garbage) return false;
   if (c->size > d->size) swap (c, d);           // optimize marking
@@ -336,8 +339,10 @@ inline void Internal::elim_add_resolvents (int pivot) {
 /*------------------------------------------------------------------------*/
 
 // Remove clauses with 'pivot' and '-pivot' by marking them as garbage and
-// at the same time push those with 'pivot' on the extension stack for
-// witness reconstruction (in 'extend').
+// at the same time push them on the extension stack for witness
+// reconstruction (in 'extend').  For 'extend' alone it would be enough to
+// save those with 'pivot' (see below), but in order to be able to restore
+// the eliminated variable (see 'restore.cpp') we need both.
 
 inline void Internal::mark_eliminated_clauses_as_garbage (int pivot) {
 
@@ -367,6 +372,7 @@ inline void Internal::mark_eliminated_clauses_as_garbage (int pivot) {
     if (d->garbage) continue;
     mark_garbage (d);
     if (d->redundant) continue;
+    external->push_clause_on_extension_stack (d, -pivot);
     elim_update_removed (d, -pivot);
   }
   erase_occs (ns);
@@ -374,7 +380,9 @@ inline void Internal::mark_eliminated_clauses_as_garbage (int pivot) {
   // This is a trick by Niklas Soerensson to avoid saving all clauses on the
   // extension stack.  Just first in extending the witness the 'pivot' is
   // forced to false and then if necessary fixed by checking the clauses in
-  // which 'pivot' occurs to be falsified.
+  // which 'pivot' occurs to be falsified.  The clauses with '-pivot' saved
+  // above are then always satisfied (since all resolvents are) and thus
+  // never flip the value of 'pivot'.
 
   external->push_unit_on_extension_stack (-pivot);
 }
@@ -386,14 +394,22 @@ inline void Internal::mark_eliminated_clauses_as_garbage (int pivot) {
 inline void Internal::try_to_eliminate_variable (int pivot) {
 
   if (!active (pivot)) return;
+  if (frozen (pivot)) {
+    LOG ("frozen variable %d can not be eliminated", pivot);
+    return;
+  }
 
   LOG ("trying to eliminate %d", pivot);
   assert (!flags (pivot).eliminated ());
 
   // First remove garbage clauses to get a (more) accurate count. There
   // might still be satisfied clauses included in this count which we have
-  // not found yet but we ignore them in the following check.
+  // not found yet but we ignore them in the following check.  This visits
+  // all clauses in both occurrence lists, which are the main effort.
   //
+  const size_t occurrences = occs (pivot).size () + occs (-pivot).size ();
+  stats.ticks.elim += 2 + occurrences;
+  stats.ticks.elim += cache_lines (occurrences, sizeof (Clause*));
   long pos = flush_occs (pivot);
   long neg = flush_occs (-pivot);
 
@@ -420,6 +436,7 @@ inline void Internal::try_to_eliminate_variable (int pivot) {
 
   assert (active (pivot));
   flags (pivot).status = Flags::ELIMINATED;
+  mark_garbage_xors (abs (pivot));
   LOG ("eliminated %d", pivot);
   stats.all.eliminated++;
   stats.now.eliminated++;
@@ -463,6 +480,12 @@ bool Internal::elim_round () {
   // time mark satisfied clauses and update 'removed' flags of variables in
   // clauses with root level assigned literals (both false and true).
   //
+  // Variables in clauses of pushed groups are not scheduled either, and
+  // neither are those in clauses with core selectors or variables added by
+  // bounded variable addition, since such clauses can not be put on the
+  // extension stack (see 'grouping' in 'group.cpp').
+  //
+  const bool check = grouping ();
   const_clause_iterator eoc = clauses.end ();
   const_clause_iterator i;
   for (i = clauses.begin (); i != eoc; i++) {
@@ -470,8 +493,8 @@ bool Internal::elim_round () {
     if (c->garbage || c->redundant) continue;
     const const_literal_iterator eol = c->end ();
     const_literal_iterator j;
-    if (c->size > size_limit) {
-      LOG (c, "variables not scheduled in too large");
+    if (c->size > size_limit || (check && grouped (c))) {
+      LOG (c, "variables not scheduled in too large or grouped");
       for (j = c->begin (); j != eol; j++)
         noccs2 (*j) = nocc2_limit_exceeded;        // thus not scheduled
     } else {
@@ -555,9 +578,20 @@ bool Internal::elim_round () {
   //
   const long limit = (2*stats.irrbytes/3) + (1<<20);
 
+  // Even with bounded occurrences traversing huge occurrence lists is too
+  // costly.  Thus the ticks of elimination attempts are limited relative
+  // to search ticks as in 'probe'.
+  //
+  long delta = stats.ticks.search;
+  delta -= lim.search_ticks.elim;
+  delta *= opts.elimreleff;
+  if (delta < opts.elimmineff) delta = opts.elimmineff;
+  if (delta > opts.elimmaxeff) delta = opts.elimmaxeff;
+  const long ticks_limit = stats.ticks.elim + delta;
+
   // Try eliminating variables according to the schedule.
   //
-  while (!unsat && !esched.empty ()) {
+  while (!unsat && !esched.empty () && stats.ticks.elim < ticks_limit) {
     int idx = esched.front ();
     esched.pop_front ();
     flags (idx).removed = false;
@@ -567,14 +601,30 @@ bool Internal::elim_round () {
     garbage_collection ();
   }
 
+  // If the tick limit was hit, the remaining scheduled variables are marked
+  // as removed again, such that they are tried in the next round.
+  //
+  if (!unsat && !esched.empty ()) {
+    VRB ("elim", stats.eliminations,
+      "tick limit hit with %ld variables left in schedule",
+      (long) esched.size ());
+    while (!esched.empty ()) {
+      const int idx = esched.front ();
+      esched.pop_front ();
+      mark_removed (idx);
+    }
+  }
+
   esched.erase ();
   reset_noccs2 ();
   reset_occs ();
 
-  // Mark all redundant clauses with eliminated variables as garbage.
+  // Mark all redundant clauses with eliminated variables as garbage and
+  // delete disconnected redundant parity constraints.
   //
   if (!unsat)
     mark_redundant_clauses_with_eliminated_variables_as_garbage ();
+  delete_garbage_xors ();
 
   int eliminated = stats.all.eliminated - old_eliminated;
 #ifndef QUIET
@@ -585,6 +635,7 @@ bool Internal::elim_round () {
 #endif
 
   lim.subsumptions_at_last_elim = stats.subsumptions;
+  lim.search_ticks.elim = stats.ticks.search;
 
   report ('e');
 
@@ -611,6 +662,11 @@ void Internal::elim () {
   if (lim.subsumptions_at_last_elim == stats.subsumptions)
     subsume ();
 
+  // Vivification after subsumption might have derived the empty clause,
+  // while watches are only connected again below if not 'unsat'.
+  //
+  if (unsat) return;
+
   if (level) backtrack ();
   reset_watches ();             // saves lots of memory
 
@@ -627,6 +683,8 @@ void Internal::elim () {
     if (old_removed == stats.removed) break;
   }
 
+  if (!unsat && opts.bva) bva ();
+
   if (!unsat) {
     init_watches ();
     connect_watches ();
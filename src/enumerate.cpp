@@ -0,0 +1,187 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Projected model enumeration with decision based blocking.  Since the
+// projection variables are decided first (see 'next_projected_variable'),
+// all of them are assigned on the decision levels up to the last level
+// 'jump' on which a projection variable was assigned.  The decisions on
+// these levels imply the projected model and their negation is a blocking
+// clause, which is usually much shorter than the negation of the whole
+// projected model.  Instead of restarting we backtrack chronologically to
+// the level before 'jump', where the blocking clause becomes unit and
+// forces the last projection decision to be flipped.  Thus the search
+// continues right where it found the previous model.
+
+// If there are no such decisions the projected model is implied on the root
+// level and blocking it makes the formula unsatisfiable.  If all decisions
+// are assumptions, flipping the last one makes the assumptions fail.
+
+// Unless the blocking clauses are kept, they contain the negation of the
+// 'guard', which is assumed last.  Thus the guard is always one of the
+// decisions in the blocking clause and flipping it ends the enumeration.
+// Since no clause contains the guard positively, every blocking clause is
+// RAT on the negation of the guard and is traced with it first.
+
+void Internal::block_projected_model (int guard) {
+
+  assert (satisfied ());
+
+  int jump = 0;
+  const const_int_iterator end = projection.end ();
+  for (const_int_iterator i = projection.begin (); i != end; i++) {
+    const int tmp = var (*i).level;
+    if (tmp > jump) jump = tmp;
+  }
+  if (guard) {
+    assert (val (guard) > 0);
+    assert (control[var (guard).level].decision == guard);
+    const int tmp = var (guard).level;
+    if (tmp > jump) jump = tmp;
+  }
+  LOG ("last projection variable assigned on level %d", jump);
+
+  // The last decision becomes unit after backtracking, while all others
+  // remain falsified.  Pseudo decision levels of satisfied assumptions do
+  // not contribute a literal.
+
+  assert (clause.empty ());
+  for (int l = jump; l > 0; l--) {
+    const int decision = control[l].decision;
+    if (decision) clause.push_back (-decision);
+  }
+  stats.blocked++;
+  LOG (clause, "blocking");
+
+  // Note that the blocking clause is irredundant, since 'reduce' would
+  // otherwise bring back blocked models.  Units are traced by 'assign_unit'.
+
+  if (proof && guard && clause.size () > 1) {
+    const int_iterator end = clause.end ();
+    const int_iterator i = find (clause.begin (), end, -guard);
+    assert (i != end);
+    swap (*i, clause[0]);
+    proof->trace_add_clause ();
+    swap (*i, clause[0]);
+  }
+
+  if (clause.empty ()) {
+    LOG ("projected model implied on root level");
+    learn_empty_clause ();
+  } else {
+    const int flipped = clause[0];
+    if (clause.size () == 1) {
+      backtrack (0);
+      assign_unit (flipped);
+      iterating = true;
+    } else {
+      Clause * c = new_clause (false);
+      watch_clause (c);
+      backtrack (var (flipped).level - 1);
+      assign_driving (flipped, c);
+    }
+    clause.clear ();
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// The projection variables are frozen during enumeration, which also brings
+// back eliminated projection variables.  Their internal variables are then
+// kept in 'projection', which is mapped during 'compact'.  The first model
+// is searched with a regular 'solve' and all further models by continuing
+// 'search' after blocking the previous model.  By default the blocking
+// clauses are guarded by a fresh activation literal, which is assumed
+// after the user assumptions and groups and falsified at the end, which
+// makes them and clauses learned from them root level satisfied as in
+// 'optimize'.  Thus the formula is not changed by 'enumerate'.  With
+// '--enumeratekeep' every reported model is blocked permanently, even if
+// the enumeration stops afterwards, such that another call to 'enumerate'
+// continues with the remaining models.  These blocking clauses are not
+// implied by the formula, thus keeping them is rejected with proofs.
+
+long External::enumerate (const vector<int> & elits,
+                          Enumerator * enumerator, long limit) {
+
+  const bool keep = internal->opts.enumeratekeep;
+  if (keep && internal->proof) {
+    Message::error (internal,
+      "can not keep blocking clauses of 'enumerate' with proofs");
+    return -1;
+  }
+
+  reset_assumptions ();
+  activate ();
+  interrupted = false;
+
+  vector<int> & guards = internal->guards;
+  if (!keep) {
+    guards.push_back (new_activation_variable ());
+    internal->assume (guards.back ());
+  }
+
+  vector<int> eprojection;
+  if (elits.empty ())
+    for (int eidx = 1; eidx <= max_var; eidx++)
+      eprojection.push_back (eidx);
+  else {
+    const const_int_iterator end = elits.end ();
+    for (const_int_iterator i = elits.begin (); i != end; i++)
+      assert (*i), assert (*i != INT_MIN),
+      eprojection.push_back (abs (*i));
+  }
+  LOG ("enumerating models projected on %ld variables",
+    (long) eprojection.size ());
+
+  const const_int_iterator end = eprojection.end ();
+  const_int_iterator i;
+  for (i = eprojection.begin (); i != end; i++) freeze (*i);
+
+  assert (internal->projection.empty ());
+  for (i = eprojection.begin (); i != end; i++)
+    internal->projection.push_back (e2i[*i]);
+  internal->projected = 0;
+  internal->budget = Budget ();
+
+  long models = 0;
+  int res = limit ? internal->solve () : 0;
+  vector<int> model;
+  bool proceed = true;
+  while (res == 10) {
+    models++;
+    LOG ("found projected model %ld", models);
+    if (internal->opts.check) {
+      extend ();
+      check (&External::val);
+    }
+    if (enumerator) {
+      for (i = eprojection.begin (); i != end; i++) {
+        const int eidx = *i, tmp = internal->val (e2i[eidx]);
+        assert (tmp);
+        model.push_back (tmp < 0 ? -eidx : eidx);
+      }
+      proceed = enumerator->model (model);
+      model.clear ();
+    }
+    internal->block_projected_model (keep ? 0 : guards.back ());
+    if (!proceed) break;
+    if (limit >= 0 && models >= limit) break;
+    res = internal->search ();
+  }
+  internal->termination = false;
+  LOG ("enumerated %ld projected models", models);
+
+  if (!keep) {
+    internal->add_original_lit (-guards.back ());
+    internal->add_original_lit (0);
+    guards.pop_back ();
+  }
+  internal->projection.clear ();
+  internal->projected = 0;
+  for (i = eprojection.begin (); i != end; i++) melt (*i);
+  solved = true;
+
+  return models;
+}
+
+};
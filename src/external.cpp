@@ -9,7 +9,12 @@ External::External (Internal * i)
   vals (0),
   solution (0),
   e2i (0),
-  internal (i)
+  clauses (0),
+  internal (i),
+  solved (false),
+  interrupted (false),
+  terminator (0),
+  learner (0)
 {
   assert (internal);
   assert (!internal->external);
@@ -33,6 +38,7 @@ void External::enlarge (int new_max_var) {
 
 void External::init (int new_max_var) {
   if (new_max_var <= max_var) return;
+  if (internal->proof) internal->proof->relocate (new_max_var);
   int new_vars = new_max_var - max_var;
   int old_internal_max_var = internal->max_var;
   int new_internal_max_var = old_internal_max_var + new_vars;
@@ -51,16 +57,154 @@ void External::init (int new_max_var) {
   max_var = new_max_var;
 }
 
+void External::reset_assumptions () {
+  if (!solved) return;
+  internal->reset_assumptions ();
+  solved = false;
+}
+
 void External::add (int elit) {
+  reset_assumptions ();
+  interrupted = false;
   if (internal->opts.check) original.push_back (elit);
   const int ilit = internalize (elit);
   assert (!elit || ilit);
   if (elit) LOG ("adding external %d as internal %d", elit, ilit);
+  else {
+    if (!groups.empty ()) {
+      Group & group = groups.back ();
+      LOG ("adding activation literal %d of group %ld",
+        -group.activation, (long) groups.size ());
+      internal->add_original_lit (-group.activation);
+      group.clauses++;
+    }
+    if (internal->opts.core) select ();
+    clauses++;
+  }
   internal->add_original_lit (ilit);
 }
 
-int External::solve () {
-  int res = internal->solve ();
+// Duplicated literals are removed before internalizing them, since after
+// 'compact' different fixed variables are mapped to the same internal
+// variable.  Cardinality constraints are saved for 'check' as 'bound
+// lits... 0' without duplicated literals.
+
+void External::add_atmost (const vector<int> & elits, int bound) {
+  assert (groups.empty ());
+  reset_assumptions ();
+  interrupted = false;
+  vector<int> sorted (elits), ilits;
+  sort (sorted.begin (), sorted.end (), lit_less_than ());
+  sorted.erase (unique (sorted.begin (), sorted.end ()), sorted.end ());
+  const const_int_iterator end = sorted.end ();
+  for (const_int_iterator i = sorted.begin (); i != end; i++) {
+    const int elit = *i;
+    assert (elit), assert (elit != INT_MIN);
+    freeze (elit);
+    ilits.push_back (internalize (elit));
+  }
+  if (internal->opts.check) {
+    atmosts.push_back (bound);
+    atmosts.insert (atmosts.end (), sorted.begin (), sorted.end ());
+    atmosts.push_back (0);
+  }
+  LOG ("adding cardinality constraint with bound %d on %ld literals",
+    bound, (long) elits.size ());
+  internal->add_atmost (ilits, bound);
+}
+
+// Parity constraints are saved for 'check' as 'lits... 0'.
+
+void External::add_xor (const vector<int> & elits) {
+  assert (groups.empty ());
+  reset_assumptions ();
+  interrupted = false;
+  vector<int> ilits;
+  const const_int_iterator end = elits.end ();
+  for (const_int_iterator i = elits.begin (); i != end; i++) {
+    const int elit = *i;
+    assert (elit), assert (elit != INT_MIN);
+    freeze (elit);
+    ilits.push_back (internalize (elit));
+  }
+  if (internal->opts.check) {
+    xors.insert (xors.end (), elits.begin (), elits.end ());
+    xors.push_back (0);
+  }
+  LOG ("adding parity constraint on %ld literals", (long) elits.size ());
+  internal->add_xor (ilits);
+}
+
+void External::assume (int elit) {
+  assert (elit);
+  reset_assumptions ();
+  interrupted = false;
+  const int ilit = internalize (elit);
+  assert (ilit);
+  LOG ("assuming external %d as internal %d", elit, ilit);
+  internal->assume (ilit);
+}
+
+// Hints for eliminated variables are ignored instead of restoring them.
+
+void External::phase (int elit) {
+  assert (elit);
+  assert (elit != INT_MIN);
+  const int eidx = abs (elit);
+  if (eidx <= max_var && eliminated (eidx)) return;
+  internal->phase (internalize (elit));
+}
+
+void External::prioritize (int elit) {
+  assert (elit);
+  assert (elit != INT_MIN);
+  const int eidx = abs (elit);
+  if (eidx <= max_var && eliminated (eidx)) return;
+  internal->prioritize (internalize (elit));
+}
+
+bool External::failed (int elit) {
+  assert (elit);
+  assert (elit != INT_MIN);
+  if (!solved) return false;
+  const int eidx = abs (elit);
+  if (eidx > max_var) return false;
+  int ilit = e2i [eidx];
+  if (!ilit) return false;
+  if (elit < 0) ilit = -ilit;
+  return internal->failed (ilit);
+}
+
+void External::freeze (int elit) {
+  assert (elit);
+  const int ilit = internalize (elit);
+  assert (ilit), (void) ilit;
+  const size_t eidx = abs (elit);
+  if (eidx >= frozentab.size ()) frozentab.resize (eidx + 1, 0);
+  unsigned & ref = frozentab[eidx];
+  if (ref < UINT_MAX) ref++;
+  LOG ("external variable %d frozen once and now frozen %u times",
+    (int) eidx, ref);
+}
+
+void External::melt (int elit) {
+  assert (elit);
+  assert (frozen (elit));
+  const size_t eidx = abs (elit);
+  if (eidx >= frozentab.size ()) return;
+  unsigned & ref = frozentab[eidx];
+  if (ref && ref < UINT_MAX) ref--;
+  LOG ("external variable %d melted once and now frozen %u times",
+    (int) eidx, ref);
+}
+
+int External::solve (const Budget * budget) {
+  const bool resume = budget && interrupted;
+  if (!resume) reset_assumptions (), activate ();
+  internal->budget = budget ? *budget : Budget ();
+  int res = internal->solve (resume);
+  interrupted = !res;
+  solved = true;
   if (res == 10) {
     extend ();
     if (internal->opts.check) check (&External::val);
@@ -70,4 +214,24 @@ int External::solve () {
 
 void External::terminate () { internal->terminate (); }
 
+bool External::terminated () {
+  return terminator && terminator->terminate ();
+}
+
+// Learned clauses depending on clause groups, core selectors or backbone
+// chunks contain internal activation literals, which have no external
+// counter part and are not exported.
+
+void External::export_learned_clause (const vector<int> & clause) {
+  assert (learner);
+  const const_int_iterator end = clause.end ();
+  const_int_iterator i;
+  for (i = clause.begin (); i != end; i++)
+    if (!internal->externalize (*i)) return;
+  if (!learner->learning ((int) clause.size ())) return;
+  for (i = clause.begin (); i != end; i++)
+    learner->learn (internal->externalize (*i));
+  learner->learn (0);
+}
+
 };
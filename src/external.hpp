@@ -41,13 +41,36 @@ using namespace std;
 
 /*------------------------------------------------------------------------*/
 
+class Bounder;
 class Clause;
 class Internal;
+class Learner;
+class Terminator;
+
+// Clause group pushed with 'push' (see 'group.cpp').
+
+struct Group {
+  int activation;       // internal activation literal
+  size_t original;      // size of 'original' when pushed
+  size_t selectors;     // number of core selectors when pushed
+  long clauses;         // number of clauses added to this group
+  Group (int a, size_t o, size_t s) :
+    activation (a), original (o), selectors (s), clauses (0) { }
+};
+
+// Selector of an original clause added with 'core' enabled (see 'core.cpp').
+
+struct Selector {
+  int activation;       // internal activation literal
+  long id;              // index of the clause in all added clauses
+  Selector (int a, long i) : activation (a), id (i) { }
+};
 
 class External {
 
   friend class Internal;
   friend class Parser;
+  friend class Proof;
   friend class Solver;
   friend struct Stats;
 
@@ -65,9 +88,21 @@ class External {
 
   vector<int> extension;
   vector<int> original;
+  vector<int> atmosts;          // original cardinality constraints
+  vector<int> xors;             // original parity constraints
+  vector<unsigned> frozentab;   // reference counts of frozen variables
+  vector<Group> groups;         // pushed clause groups
+  vector<Selector> selectors;   // selectors of clauses in cores
+  long clauses;                 // number of added clauses
 
   Internal * internal;
 
+  bool solved;            // assumptions of last 'solve' still valid
+  bool interrupted;       // last 'solve' can be resumed
+
+  Terminator * terminator;      // connected terminator (if non-zero)
+  Learner * learner;            // connected learner (if non-zero)
+
   /*----------------------------------------------------------------------*/
 
   void push_clause_on_extension_stack (Clause *, int pivot);
@@ -94,18 +129,88 @@ class External {
       assert (lit != INT_MIN);
       const int eidx = abs (lit);
       if (eidx > max_var) init (eidx);
+      else if (eliminated (eidx)) restore_clauses (eidx);
       res = e2i [eidx];
       if (lit < 0) res = -res;
     } else res = 0;
     return res;
   }
 
+  // Variables removed by 'elim' or 'decompose' are brought back by
+  // restoring their clauses from the extension stack in 'restore.cpp', as
+  // soon they are used again in 'add', 'assume' or 'freeze'.
+  //
+  bool eliminated (int eidx);
+  void restore_clauses (int eidx);
+
+  // Frozen variables are never eliminated nor substituted.
+  //
+  void freeze (int lit);
+  void melt (int lit);
+  bool frozen (int lit) const {
+    const size_t eidx = abs (lit);
+    return eidx < frozentab.size () && frozentab[eidx] > 0;
+  }
+
+  // Assumptions are kept after 'solve' (for 'failed') and only reset
+  // during the next 'add', 'assume' or 'solve'.
+  //
+  void reset_assumptions ();
+
   void add (int lit);
+  void add_atmost (const vector<int> & lits, int bound);
+  void add_xor (const vector<int> & lits);
+  void assume (int lit);
+  bool failed (int lit);
+  void phase (int lit);
+  void prioritize (int lit);
 
-  int solve ();
+  int solve (const Budget * budget = 0);
+
+  // Batched solving of queries with shared assumptions in 'batch.cpp'.
+  //
+  void solve_batch (const vector< vector<int> > & queries,
+                    vector<int> & results);
+
+  // Clause groups in 'group.cpp'.  The activation literals of all pushed
+  // groups and then those of all core selectors are assumed in every
+  // 'solve' (after the user assumptions) by 'activate'.
+  //
+  void push ();
+  void pop ();
+  void activate ();
+  int new_activation_variable ();
+
+  // Core-guided optimization in 'optimize.cpp'.
+  //
+  void totalize (const vector<int> & inputs, vector<int> & outputs,
+                 int guard);
+  int optimize (const vector<int> & soft, const vector<long> & weights,
+                long & cost, Bounder *);
+
+  // Unsatisfiable cores in 'core.cpp'.
+  //
+  void select ();
+  int core_literal (long tag);
+  void core (vector<int> & assumptions, vector<long> & clauses,
+             bool minimize);
+
+  // Backbone computation in 'backbone.cpp'.
+  //
+  int solve_backbone (const vector<int> & assumed, int lit);
+  int backbone (vector<int> & lits);
+
+  // Projected model enumeration in 'enumerate.cpp'.
+  //
+  long enumerate (const vector<int> & projection, Enumerator *, long limit);
 
   void terminate ();
 
+  // Called from 'Internal::terminating' and 'Internal::analyze'.
+  //
+  bool terminated ();
+  void export_learned_clause (const vector<int> & clause);
+
   inline int val (int lit) const {
     assert (lit != INT_MIN);
     int idx = abs (lit);
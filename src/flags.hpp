@@ -9,6 +9,7 @@ struct Flags {        // Variable flags.
   bool keep      : 1; // keep in learned clause in 'minimize/shrink'
   bool poison    : 1; // can not be removed in 'minimize/shrink'
   bool removable : 1; // can be removed in 'minimize/shrink'
+  bool shrinkable: 1; // on trail of block to shrink in 'shrink'
   bool added     : 1; // added since last 'subsume' round
   bool removed   : 1; // removed since last 'elim' round
 
@@ -21,13 +22,19 @@ struct Flags {        // Variable flags.
 
   unsigned char status : 2;
 
+  // Bit 1 for the positive and bit 2 for the negative literal (see 'bign').
+
+  unsigned char assumed : 2;    // assumed literal in next 'solve'
+  unsigned char failed  : 2;    // failed assumption in last 'solve'
+
   // initialized explicitly in 'Internal::init' through this
 
   void init () {
-    assert (sizeof (Flags) == 1);
-    seen = keep = poison = removable = false;
+    assert (sizeof (Flags) == 2);
+    seen = keep = poison = removable = shrinkable = false;
     added = removed = true;
     status = ACTIVE;
+    assumed = failed = 0;
   }
 
   bool active () const { return status == ACTIVE; }
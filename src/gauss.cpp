@@ -0,0 +1,327 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Gauss-Jordan elimination on parity constraints during probing.  The
+// rows of the matrix are the native parity constraints (see 'xor.cpp')
+// and parity constraints encoded in irredundant clauses.  Adding rows
+// modulo two derives new parity constraints implied by the formula.  Units
+// and equivalences (as binary clauses) are used directly, the latter by
+// equivalent literal substitution in 'decompose'.  Longer reduced rows with
+// at most 'gausskeep' variables are kept as redundant native parity
+// constraints, which are propagated during search until the next round
+// replaces them (see 'xor.cpp').  Thus conflicts on long parity chains are
+// found without a clause encoding of all the sums of their rows.  The matrix
+// is bit-packed into words, such that adding two rows is a simple loop over
+// words, which compilers can vectorize.  The number of word operations is
+// limited by 'gaussmaxeff' and elimination is stopped when it is reached,
+// which is sound since all rows stay implied.  Since the derived clauses
+// are not necessarily implied by unit propagation from existing clauses,
+// Gaussian elimination is disabled if a proof is traced.
+
+typedef uint64_t Word;
+
+// Only run if there are new units, substituted variables, original clauses
+// or parity constraints since the last round.
+
+bool Internal::gaussing () {
+  if (!opts.gauss) return false;
+  if (proof) return false;
+  if (lim.fixed_at_last_gauss != stats.all.fixed) return true;
+  if (lim.substituted_at_last_gauss != stats.all.substituted) return true;
+  return lim.added_at_last_gauss != stats.original + stats.xors.added;
+}
+
+/*------------------------------------------------------------------------*/
+
+// A parity constraint on 'n' variables is encoded by '2^(n-1)' clauses
+// over exactly these variables, where the number of negative literals in
+// each clause has the same parity, which is the negation of the parity of
+// the constraint.  Each constraint is found only once by starting from its
+// unique clause with at most one negative literal, which has to be the
+// literal with the smallest variable index.  The other clauses are found
+// in the occurrence lists of this variable.
+
+void Internal::gauss_detect (vector<Xor*> & rows) {
+
+  const int maxsize = opts.gaussmaxsize;
+  assert (maxsize <= 6);                // fits sign patterns into a word
+  init_occs ();
+
+  vector<Clause*> candidates;
+  const const_clause_iterator eoc = clauses.end ();
+  const_clause_iterator i;
+  for (i = clauses.begin (); i != eoc; i++) {
+    Clause * c = *i;
+    if (c->garbage || c->redundant) continue;
+    if (c->size < 3 || c->size > maxsize) continue;
+    const const_literal_iterator eol = c->end ();
+    const_literal_iterator j;
+    for (j = c->begin (); j != eol; j++)
+      if (val (*j)) break;
+    if (j != eol) continue;
+    int negative = 0, smallest = 0;
+    for (j = c->begin (); j != eol; j++) {
+      const int lit = *j;
+      occs (lit).push_back (c);
+      if (lit < 0) negative++;
+      if (!smallest || abs (lit) < abs (smallest)) smallest = lit;
+    }
+    if (negative > 1) continue;
+    if (negative && smallest > 0) continue;
+    candidates.push_back (c);
+  }
+
+  vector<int> vars;
+  const const_clause_iterator eoca = candidates.end ();
+  for (i = candidates.begin (); i != eoca; i++) {
+    Clause * c = *i;
+    const int size = c->size;
+    bool odd = false;
+    vars.clear ();
+    const const_literal_iterator eol = c->end ();
+    const_literal_iterator j;
+    for (j = c->begin (); j != eol; j++) {
+      if (*j < 0) odd = !odd;
+      vars.push_back (abs (*j));
+    }
+    sort (vars.begin (), vars.end ());
+    const int first = vars[0];
+    const Occs & pos = occs (first), & neg = occs (-first);
+    if ((long) (pos.size () + neg.size ()) > opts.gaussocclim) continue;
+    Word found = 0;
+    long count = 0;
+    for (int sign = 1; sign >= -1; sign -= 2) {
+      const Occs & os = (sign > 0) ? pos : neg;
+      const const_occs_iterator eoo = os.end ();
+      for (const_occs_iterator k = os.begin (); k != eoo; k++) {
+        Clause * d = *k;
+        if (d->size != size) continue;
+        unsigned pattern = 0;
+        bool parity = false;
+        const const_literal_iterator eold = d->end ();
+        const_literal_iterator l;
+        for (l = d->begin (); l != eold; l++) {
+          const int lit = *l, idx = abs (lit);
+          int p = 0;
+          while (p < size && vars[p] != idx) p++;
+          if (p == size) break;
+          if (lit < 0) pattern |= 1u << p, parity = !parity;
+        }
+        if (l != eold || parity != odd) continue;
+        const Word bit = (Word) 1 << pattern;
+        if (found & bit) continue;
+        found |= bit;
+        count++;
+      }
+    }
+    if (count < (1l << (size - 1))) continue;
+    LOG (c, "detected parity constraint with parity %d of", (int) !odd);
+    stats.gauss.detected++;
+    Xor * x = new Xor (!odd);
+    x->vars = vars;
+    rows.push_back (x);
+  }
+
+  reset_occs ();
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::gauss_add (int a, int b) {
+  assert (clause.empty ());
+  clause.push_back (a);
+  clause.push_back (b);
+  Clause * c = new_clause (true, 2);
+  LOG (c, "Gaussian elimination binary");
+  watch_clause (c);
+  clause.clear ();
+  stats.gauss.binaries++;
+}
+
+void Internal::gauss_keep (const vector<int> & vars, bool parity) {
+  if (!xtab) init_xors ();
+  Xor * x = new Xor (parity);
+  x->redundant = true;
+  x->vars = vars;
+  LOG (vars, "Gaussian elimination parity constraint with parity %d on",
+    (int) parity);
+  xors.push_back (x);
+  const const_int_iterator end = vars.end ();
+  for (const_int_iterator i = vars.begin (); i != end; i++)
+    xoccs (*i).push_back (x);
+  stats.gauss.xors++;
+}
+
+void Internal::gauss () {
+
+  if (!gaussing ()) return;
+  if (level) backtrack ();
+  assert (!unsat);
+
+  START (gauss);
+  stats.gauss.rounds++;
+
+  // Redundant rows of the last round are derived again if still useful.
+  //
+  delete_redundant_xors ();
+
+  // Collect rows with root level assigned variables removed.
+  //
+  vector<Xor*> rows;
+  gauss_detect (rows);
+  const const_xor_iterator eox = xors.end ();
+  const_xor_iterator i;
+  for (i = xors.begin (); i != eox; i++) {
+    const Xor * x = *i;
+    Xor * y = new Xor (x->parity);
+    const const_int_iterator eol = x->vars.end ();
+    for (const_int_iterator j = x->vars.begin (); j != eol; j++) {
+      const int idx = *j, tmp = val (idx);
+      if (tmp > 0) y->parity = !y->parity;
+      else if (!tmp) y->vars.push_back (idx);
+    }
+    rows.push_back (y);
+  }
+
+  // Map variables to columns and fill the bit-packed matrix.
+  //
+  vector<int> column (max_var + 1, -1), vars;
+  size_t m = rows.size ();
+  for (size_t r = 0; r < m; r++) {
+    const vector<int> & row = rows[r]->vars;
+    for (const_int_iterator j = row.begin (); j != row.end (); j++)
+      if (column[*j] < 0) column[*j] = vars.size (), vars.push_back (*j);
+  }
+  const size_t n = vars.size (), words = (n + 63) / 64;
+  const double limit = opts.gaussmaxeff;
+  if (m * words > limit) {
+    VRB ("gauss", stats.gauss.rounds,
+      "skipping Gaussian elimination of too large %ld x %ld matrix",
+      (long) m, (long) n);
+    for (size_t r = 0; r < m; r++) delete rows[r];
+    rows.clear ();
+    m = 0;
+  }
+  vector<Word> matrix (m * words, 0);
+  vector<bool> parity (m), changed (m, false);
+  for (size_t r = 0; r < m; r++) {
+    Xor * x = rows[r];
+    Word * row = &matrix[r * words];
+    const const_int_iterator eol = x->vars.end ();
+    for (const_int_iterator j = x->vars.begin (); j != eol; j++) {
+      const int c = column[*j];
+      row[c / 64] |= (Word) 1 << (c & 63);
+    }
+    parity[r] = x->parity;
+    delete x;
+  }
+  stats.gauss.rows += m;
+
+  // Gauss-Jordan elimination.  The pivot row has no bits in columns before
+  // the pivot column.  So adding it only needs to start at its word.
+  //
+  double effort = 0;
+  size_t rank = 0;
+  for (size_t c = 0; c < n && rank < m && effort <= limit; c++) {
+    const size_t w = c / 64;
+    const Word bit = (Word) 1 << (c & 63);
+    size_t p = rank;
+    while (p < m && !(matrix[p * words + w] & bit)) p++;
+    if (p == m) continue;
+    if (p != rank) {
+      swap_ranges (matrix.begin () + p * words,
+                   matrix.begin () + (p + 1) * words,
+                   matrix.begin () + rank * words);
+      swap (parity[p], parity[rank]);
+      swap (changed[p], changed[rank]);
+    }
+    const Word * pivot = &matrix[rank * words];
+    for (size_t r = 0; r < m; r++) {
+      if (r == rank) continue;
+      Word * row = &matrix[r * words];
+      if (!(row[w] & bit)) continue;
+      for (size_t k = w; k < words; k++) row[k] ^= pivot[k];
+      if (parity[rank]) parity[r] = !parity[r];
+      changed[r] = true;
+      effort += words - w;
+    }
+    rank++;
+  }
+
+  // Rows with at most two variables give the empty clause, units or
+  // equivalences.  The latter are skipped if elimination was stopped early
+  // and one of its variables became a unit.  Longer rows are only kept if
+  // they were changed by elimination, since otherwise they are already
+  // given as constraint or clauses, and if none of their variables became
+  // a unit in this loop.
+  //
+  const size_t keep = opts.gausskeep;
+  vector<int> found;
+  long units = 0, equivalences = 0, kept = 0;
+  for (size_t r = 0; !unsat && r < m; r++) {
+    const Word * row = &matrix[r * words];
+    const size_t limit = changed[r] ? max (keep, (size_t) 2) : 2;
+    found.clear ();
+    for (size_t k = 0; found.size () <= limit && k < words; k++) {
+      Word word = row[k];
+      for (int b = 0; word && found.size () <= limit; b++, word >>= 1)
+        if (word & 1) found.push_back (vars[64 * k + b]);
+    }
+    const size_t count = found.size ();
+    if (count > limit) continue;
+    if (count > 2) {
+      const_int_iterator j;
+      for (j = found.begin (); j != found.end (); j++)
+        if (val (*j)) break;
+      if (j != found.end ()) continue;
+      gauss_keep (found, parity[r]);
+      kept++;
+      continue;
+    }
+    if (!count) {
+      if (!parity[r]) continue;
+      LOG ("Gaussian elimination yields empty clause");
+      learn_empty_clause ();
+    } else if (count == 1) {
+      const int lit = parity[r] ? found[0] : -found[0];
+      const int tmp = val (lit);
+      if (tmp > 0) continue;
+      if (tmp < 0) {
+        LOG ("Gaussian elimination unit %d inconsistent", lit);
+        learn_empty_clause ();
+        continue;
+      }
+      LOG ("Gaussian elimination unit %d", lit);
+      assign_unit (lit);
+      stats.gauss.units++;
+      units++;
+    } else {
+      const int a = found[0], b = found[1];
+      if (val (a) || val (b)) continue;
+      LOG ("Gaussian elimination equivalence %d = %d", a,
+        parity[r] ? -b : b);
+      gauss_add (a, parity[r] ? b : -b);
+      gauss_add (-a, parity[r] ? -b : b);
+      equivalences++;
+    }
+  }
+
+  if (!unsat && propagated < trail.size () && !propagate ()) {
+    LOG ("propagating Gaussian elimination units results in empty clause");
+    learn_empty_clause ();
+  }
+
+  VRB ("gauss", stats.gauss.rounds,
+    "%ld units, %ld equivalences and %ld kept rows "
+    "in %ld x %ld matrix of rank %ld",
+    units, equivalences, kept, (long) m, (long) n, (long) rank);
+
+  lim.fixed_at_last_gauss = stats.all.fixed;
+  lim.substituted_at_last_gauss = stats.all.substituted;
+  lim.added_at_last_gauss = stats.original + stats.xors.added;
+
+  STOP (gauss);
+}
+
+};
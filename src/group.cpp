@@ -0,0 +1,99 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Clause groups are implemented with activation literals, which are fresh
+// internal variables without external counter part.  All clauses added
+// while a group is pushed get the negation of the activation literal of
+// the last pushed group added, which in turn is assumed in every 'solve'.
+// Since learned clauses depending on group clauses contain the negation
+// of the activation literal too, popping the group by adding the negation
+// of its activation literal as unit makes all of them root level satisfied.
+// They are then collected during the next 'reduce' and the fixed activation
+// variable is removed by the next 'compact'.  Thus long sessions with many
+// pushed and popped groups do not accumulate dead selector variables as
+// with activation literals managed by the user.
+
+// Activation variables are internal variables without external variable.
+
+int External::new_activation_variable () {
+  const int res = internal->max_var + 1;
+  internal->init (res);
+  internal->i2e[res] = 0;
+  internal->internals++;
+  return res;
+}
+
+void External::push () {
+  reset_assumptions ();
+  interrupted = false;
+  const int activation = new_activation_variable ();
+  groups.push_back (Group (activation, original.size (), selectors.size ()));
+  LOG ("pushed group %ld with activation literal %d",
+    (long) groups.size (), activation);
+}
+
+void External::pop () {
+  assert (!groups.empty ());
+  reset_assumptions ();
+  interrupted = false;
+  const Group & group = groups.back ();
+  const int activation = group.activation;
+  LOG ("popping group %ld with activation literal %d and %ld clauses",
+    (long) groups.size (), activation, group.clauses);
+  internal->stats.popped.groups++;
+  internal->stats.popped.clauses += group.clauses;
+  original.resize (group.original);
+  for (size_t i = group.selectors; i < selectors.size (); i++) {
+    internal->add_original_lit (-selectors[i].activation);
+    internal->add_original_lit (0);
+  }
+  selectors.erase (selectors.begin () + group.selectors, selectors.end ());
+  groups.pop_back ();
+  internal->add_original_lit (-activation);
+  internal->add_original_lit (0);
+}
+
+void External::activate () {
+  const vector<Group>::const_iterator end = groups.end ();
+  vector<Group>::const_iterator i;
+  for (i = groups.begin (); i != end; i++)
+    internal->assume (i->activation);
+  const vector<Selector>::const_iterator eos = selectors.end ();
+  vector<Selector>::const_iterator j;
+  for (j = selectors.begin (); j != eos; j++)
+    internal->assume (j->activation);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Clauses with activation literals can not be saved on the extension stack
+// in external form.  Thus their variables are not eliminated (see
+// 'elim_round'), which is also a good idea since they will be popped soon.
+// The same applies to variables added by bounded variable addition.
+
+// Checking clauses is only needed if there are internal variables without
+// external counter part at all, which besides activation variables of
+// groups also includes core selectors, activation literals of 'backbone',
+// 'optimize' and 'enumerate' and variables added by bounded variable
+// addition.  They are counted in 'internals', which is updated whenever
+// such a variable is added and recomputed by 'compact'.
+
+bool Internal::grouping () {
+#ifndef NDEBUG
+  int count = 0;
+  for (int idx = 1; idx <= max_var; idx++)
+    if (!i2e[idx]) count++;
+  assert (count == internals);
+#endif
+  return internals > 0;
+}
+
+bool Internal::grouped (Clause * c) {
+  const const_literal_iterator end = c->end ();
+  for (const_literal_iterator i = c->begin (); i != end; i++)
+    if (!externalize (*i)) return true;
+  return false;
+}
+
+};
@@ -0,0 +1,36 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Users often know a (near) solution, for instance from a previous similar
+// problem.  Setting the saved and target phases to this solution lets the
+// first decisions follow it.  To give these hints a chance the next
+// 'rephase' is delayed by a full rephase interval (during the first
+// 'solve' the interval is initialized in 'init_solving' anyhow).
+
+void Internal::phase (int lit) {
+  const int idx = vidx (lit);
+  LOG ("setting phase of %d to %d", idx, sign (lit));
+  phases[idx] = target_phases[idx] = sign (lit);
+  if (!stats.solves) return;
+  const long limit = stats.conflicts + inc.rephase;
+  if (lim.rephase < limit) lim.rephase = limit;
+}
+
+// Moving a variable to the front of the VMTF queue makes it the next
+// decision, exactly as if it was bumped during conflict analysis.  Thus the
+// last prioritized variable is decided first.  With EVSIDS scores the same
+// is achieved by raising its score above the maximum score in the heap.
+
+void Internal::prioritize (int lit) {
+  LOG ("prioritizing %d", vidx (lit));
+  if (!scoring) { bump_variable (lit); return; }
+  const int idx = vidx (lit);
+  if (!scores.empty ()) {
+    const double top = score (scores.front ());
+    if (score (idx) <= top) score (idx) = top + score_inc;
+  }
+  if (scores.contains (idx)) scores.update (idx);
+}
+
+};
@@ -18,10 +18,15 @@ Internal::Internal ()
   vals (0),
   marks (0),
   phases (0),
+  target_phases (0),
+  best_phases (0),
   i2e (0),
+  i2p (0),
+  internals (0),
   vtab (0),
   ltab (0),
   ftab (0),
+  stab (0),
   btab (0),
   otab (0),
   ntab (0),
@@ -29,11 +34,22 @@ Internal::Internal ()
   ptab (0),
   big (0),
   wtab (0),
+  atab (0),
+  xtab (0),
   conflict (0),
   propagated (0),
   probagated (0),
   probagated2 (0),
+  atmost_propagated (0),
+  xor_propagated (0),
+  target_assigned (0),
+  best_assigned (0),
+  projected (0),
   esched (more_noccs2 (this)),
+  scores (score_smaller (this)),
+  score_inc (1),
+  scoring (false),
+  stable (false),
   wg (0.5), ws (0.5),
   proof (0),
   opts (this),
@@ -45,9 +61,15 @@ Internal::Internal ()
   internal (this),
   external (0)
 {
-  control.push_back (Level (0));
+  control.push_back (Level (0, 0));
   binary_subsuming.redundant = false;
   binary_subsuming.size = 2;
+  atmost_reason.redundant = true;
+  atmost_reason.reason = false;
+  atmost_reason.size = 0;
+  xor_reason.redundant = true;
+  xor_reason.reason = false;
+  xor_reason.size = 0;
 }
 
 Internal::~Internal () {
@@ -57,17 +79,27 @@ Internal::~Internal () {
   if (vtab) DELETE_ONLY (vtab, Var, vsize);
   if (ltab) DELETE_ONLY (ltab, Link, vsize);
   if (ftab) DELETE_ONLY (ftab, Flags, vsize);
+  if (stab) DELETE_ONLY (stab, double, vsize);
   if (btab) DELETE_ONLY (btab, long, vsize);
   if (ptab) DELETE_ONLY (ptab, int, 2*vsize);
   if (big) RELEASE_DELETE (big, Bins, 2*vsize);
   if (vals) { vals -= vsize; DELETE_ONLY (vals, signed_char, 2*vsize); }
   if (marks) DELETE_ONLY (marks, signed_char, vsize);
   if (phases) DELETE_ONLY (phases, signed_char, vsize);
+  if (target_phases) DELETE_ONLY (target_phases, signed_char, vsize);
+  if (best_phases) DELETE_ONLY (best_phases, signed_char, vsize);
   if (i2e) DELETE_ONLY (i2e, int, vsize);
+  if (i2p) DELETE_ONLY (i2p, int, vsize);
   if (otab) reset_occs ();
   if (ntab) reset_noccs ();
   if (ntab2) reset_noccs2 ();
   if (wtab) reset_watches ();
+  if (atab) reset_atmosts ();
+  for (atmost_iterator i = constraints.begin (); i != constraints.end (); i++)
+    delete *i;
+  if (xtab) reset_xors ();
+  for (xor_iterator i = xors.begin (); i != xors.end (); i++)
+    delete *i;
   delete output;
 }
 
@@ -87,18 +119,27 @@ void Internal::enlarge (int new_max_var) {
   size_t new_vsize = vsize ? 2*vsize : 1 + (size_t) new_max_var;
   while (new_vsize <= (size_t) new_max_var) new_vsize *= 2;
   LOG ("enlarge internal from size %ld to new size %ld", vsize, new_vsize);
-  // Ordered in the size of allocated memory (larger block first).
-  ENLARGE_ZERO (wtab, Watches, 2*vsize, 2*new_vsize);
+  // Ordered in the size of allocated memory (larger block first).  The
+  // watches are allocated initially, but bounded variable addition adds new
+  // variables while watches are reset and occurrence lists are used.
+  if (wtab || !vsize) ENLARGE_ZERO (wtab, Watches, 2*vsize, 2*new_vsize);
+  if (otab) ENLARGE_ZERO (otab, Occs, 2*vsize, 2*new_vsize);
+  if (atab) ENLARGE_ZERO (atab, Atmosts, 2*vsize, 2*new_vsize);
+  if (xtab) ENLARGE_ZERO (xtab, Xors, vsize, new_vsize);
   ENLARGE_ONLY (vtab, Var, vsize, new_vsize);
   ENLARGE_ONLY (ltab, Link, vsize, new_vsize);
+  ENLARGE_ZERO (stab, double, vsize, new_vsize);
   ENLARGE_ZERO (btab, long, vsize, new_vsize);
   ENLARGE_ONLY (ptab, int, 2*vsize, 2*new_vsize);
   ENLARGE_ONLY (i2e, int, vsize, new_vsize);
+  ENLARGE_ZERO (i2p, int, vsize, new_vsize);
   enlarge_vals (new_vsize);
   ENLARGE_ONLY (phases, signed_char, vsize, new_vsize);
+  ENLARGE_ZERO (target_phases, signed_char, vsize, new_vsize);
+  ENLARGE_ZERO (best_phases, signed_char, vsize, new_vsize);
   ENLARGE_ZERO (marks, signed_char, vsize, new_vsize);
   ENLARGE_ONLY (ftab, Flags, vsize, new_vsize);
-  assert (sizeof (Flags) == 1);
+  assert (sizeof (Flags) == 2);
   vsize = new_vsize;
 }
 
@@ -136,7 +177,10 @@ void Internal::init (int new_max_var) {
   assert (!btab[0]);
   init_queue (new_max_var);
   LOG ("initialized %d internal variables", new_max_var - max_var);
+  const int old_max_var = max_var;
   max_var = new_max_var;
+  if (scoring)
+    for (int i = old_max_var + 1; i <= new_max_var; i++) scores.push_back (i);
 }
 
 void Internal::add_original_lit (int lit) {
@@ -162,6 +206,7 @@ int Internal::search () {
     else if (iterating) iterate ();        // report learned unit
     else if (satisfied ()) res = 10;       // all variables satisfied
     else if (terminating ()) break;        // limit hit or asynchronous abort
+    else if (stabilizing ()) stabilize (); // switch focused/stable mode
     else if (restarting ()) restart ();    // restart by backtracking
     else if (rephasing ()) rephase ();     // reset phases
     else if (reducing ()) reduce ();       // collect useless learned clauses
@@ -169,15 +214,29 @@ int Internal::search () {
     else if (subsuming ()) subsume ();     // subsumption algorithm
     else if (eliminating ()) elim ();      // bounded variable elimination
     else if (compactifying ()) compact (); // collect internal variables
-    else decide ();                        // otherwise pick next decision
+    else res = decide ();                  // next decision or assumption
   STOP (search);
   return res;
 }
 
 /*------------------------------------------------------------------------*/
 
+// The inprocessing schedules and the averages are only initialized during
+// the first call to 'solve'.  Since all limits are given in terms of the
+// total number of conflicts they simply continue in later incremental calls
+// where they left off.  Otherwise each call would trigger all inprocessors
+// early and restart with fresh averages.  Only the conflict and decision
+// limits apply to each call separately.
+
 void Internal::init_solving () {
 
+  if (stats.solves++) {
+    LOG ("keeping limits and averages of previous %ld calls",
+      stats.solves - 1);
+    init_call_limits ();
+    return;
+  }
+
   lim.restart = opts.restartint;
 
   lim.reduce  = opts.reduceinit;
@@ -201,17 +260,63 @@ void Internal::init_solving () {
   inc.rephase = opts.rephaseint;
   lim.rephase = opts.rephaseint;
 
-  lim.conflict = (opts.clim < 0) ? -1 : stats.conflicts + opts.clim;
-  lim.decision = (opts.dlim < 0) ? -1 : stats.decisions + opts.dlim;
+  inc.stabilize = opts.stabilizeinit;
+  lim.stabilize = opts.stabilizeinit;
 
   INIT_EMA (fast_glue_avg, opts.emagluefast);
   INIT_EMA (jump_avg, opts.emajump);
   INIT_EMA (size_avg, opts.emasize);
   INIT_EMA (slow_glue_avg, opts.emaglueslow);
+
+  INIT_EMA (saved_avg.fast_glue, opts.emagluefast);
+  INIT_EMA (saved_avg.jump, opts.emajump);
+  INIT_EMA (saved_avg.size, opts.emasize);
+  INIT_EMA (saved_avg.slow_glue, opts.emaglueslow);
+
+  init_call_limits ();
+}
+
+// The per call limits are the minimum of the option and the budget given
+// to 'solve' (where negative values mean unlimited).
+
+static long min_limit (long a, long b) {
+  if (a < 0) return b;
+  if (b < 0) return a;
+  return a < b ? a : b;
+}
+
+void Internal::init_call_limits () {
+  long l = min_limit (opts.clim, budget.conflicts);
+  lim.conflict = (l < 0) ? -1 : stats.conflicts + l;
+  l = min_limit (opts.dlim, budget.decisions);
+  lim.decision = (l < 0) ? -1 : stats.decisions + l;
+  l = min_limit (opts.plim, budget.propagations);
+  lim.propagation = (l < 0) ? -1 : stats.propagations.search + l;
 }
 
-int Internal::solve () {
+// Garbage is collected initially and if there are new root level units.
+// However, the activation literals fixed by popping clause groups do not
+// count here.  Collecting garbage in every call would be too costly with
+// many short calls and popped groups in between.  Instead the clauses of
+// popped groups are collected during the next 'reduce' or as soon they
+// make up a substantial part of all irredundant clauses.
+
+bool Internal::collecting () {
+  if (stats.solves == 1) return true;
+  long units = stats.all.fixed - lim.fixed_at_last_collect;
+  long groups = stats.popped.groups - lim.popped_groups_at_last_collect;
+  if (units > groups) return true;
+  long clauses = stats.popped.clauses - lim.popped_clauses_at_last_collect;
+  return clauses > 0 && clauses >= opts.poplim * stats.irredundant;
+}
+
+// If 'resume' is set the previous call was interrupted and nothing changed
+// since then.  So we keep the trail and continue the search.
+
+int Internal::solve (bool resume) {
   SECTION ("solving");
+  if (level && !resume) backtrack ();
+  else if (level) LOG ("resuming search on decision level %d", level);
   int res;
   if (unsat) {
     LOG ("already inconsistent");
@@ -220,17 +325,18 @@ int Internal::solve () {
     LOG ("clashing original clause");
     learn_empty_clause ();
     res = 20;
-  } else if (!propagate ()) {
+  } else if (!level && !propagate ()) {
     LOG ("root level propagation produces conflict");
     learn_empty_clause ();
     res = 20;
   } else {
     init_solving ();
-    garbage_collection ();
+    update_decision_heuristic ();
+    if (!level && collecting ()) garbage_collection ();
     res = search ();
   }
   report ((res == 10) ? '1' : (res == 20 ? '0' : '?'));
-  if (!res) assert (termination), termination = 0;
+  termination = false;
   return res;
 }
 
@@ -280,6 +386,41 @@ void External::check (int (External::*a)(int) const) {
     } else if (!satisfied && (this->*a) (lit) > 0) satisfied = true;
   }
 
+  // Then check that all (saved) cardinality constraints are satisfied.
+  //
+  for (const_int_iterator i = atmosts.begin (); i != atmosts.end (); i++) {
+    start = i;
+    const int bound = *i++;
+    int count = 0;
+    while (*i) if ((this->*a) (*i++) > 0) count++;
+    if (count <= bound) continue;
+    fflush (stdout);
+    fprintf (stderr,
+      "*** cadical error: violated cardinality constraint with bound %d:\n",
+      bound);
+    for (const_int_iterator j = start + 1; j != i; j++)
+      fprintf (stderr, "%d ", *j);
+    fputs ("0\n", stderr);
+    fflush (stderr);
+    abort ();
+  }
+
+  // Finally check that all (saved) parity constraints are satisfied.
+  //
+  for (const_int_iterator i = xors.begin (); i != xors.end (); i++) {
+    start = i;
+    bool odd = false;
+    while (*i) if ((this->*a) (*i++) > 0) odd = !odd;
+    if (odd) continue;
+    fflush (stdout);
+    fputs ("*** cadical error: violated parity constraint:\n", stderr);
+    for (const_int_iterator j = start; j != i; j++)
+      fprintf (stderr, "%d ", *j);
+    fputs ("0\n", stderr);
+    fflush (stderr);
+    abort ();
+  }
+
 #ifndef QUIET
   if (internal->opts.verbose) {
     MSG ("");
@@ -11,6 +11,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <cctype>
+#include <stdint.h>
 
 /*------------------------------------------------------------------------*/
 
@@ -22,6 +23,7 @@
 /*------------------------------------------------------------------------*/
 
 #include "arena.hpp"
+#include "atmost.hpp"
 #include "bins.hpp"
 #include "cadical.hpp"
 #include "clause.hpp"
@@ -46,11 +48,14 @@
 #include "profile.hpp"
 #include "proof.hpp"
 #include "queue.hpp"
+#include "radix.hpp"
 #include "resources.hpp"
+#include "score.hpp"
 #include "stats.hpp"
 #include "util.hpp"
 #include "var.hpp"
 #include "watch.hpp"
+#include "xor.hpp"
 
 /*------------------------------------------------------------------------*/
 
@@ -76,6 +81,7 @@ class Internal {
   friend class Proof;
   friend class Solver;
   friend struct Stats;
+  friend struct Walker;
 
 #ifdef LOGGING
   friend struct EMA;
@@ -85,14 +91,17 @@ class Internal {
   // Comparison functors for sorting.
   //
   friend struct bumped_earlier;
+  friend struct bva_less_occs;
   friend struct less_negated_occs;
   friend struct less_usefull;
   friend struct more_noccs2;
+  friend struct not_assumed;
+  friend struct score_smaller;
   friend struct subsume_less_noccs;
   friend struct trail_bumped_smaller;
   friend struct better_watch;
   friend struct trail_larger;
-  friend struct trail_assigned_smaller;
+  friend struct trail_rank;
   friend struct vivify_less_clause;
   friend struct vivify_more_noccs;
 
@@ -114,11 +123,16 @@ class Internal {
   signed char * vals;           // assignment          [-max_var,max_var]
   signed char * marks;          // signed marks        [1,max_var]
   signed char * phases;         // saved assignment    [1,max_var]
+  signed char * target_phases;  // largest conflict free assignment
+  signed char * best_phases;    // largest assignment so far
   int * i2e;			// internal idx to external lit
+  int * i2p;                    // internal idx to proof idx if no 'i2e'
+  int internals;                // number of variables without 'i2e'
   Queue queue;                  // variable move to front decision queue
   Var * vtab;                   // variable table
   Link * ltab;                  // table of links for decision queue
   Flags * ftab;                 // seen, poison, minimized flags table
+  double * stab;                // EVSIDS scores
   long * btab;                  // enqueue time stamps for queue
   Occs * otab;                  // table of occurrences for all literals
   long * ntab;                  // table number one sided occurrences
@@ -126,23 +140,44 @@ class Internal {
   int * ptab;                   // propagated table
   Bins * big;                   // binary implication graph
   Watches * wtab;               // table of watches for all literals
+  Atmosts * atab;               // cardinality constraint occurrences
+  Xors * xtab;                  // parity constraint occurrences
   Clause * conflict;            // set in 'propagation', reset in 'analyze'
   size_t propagated;            // next trail position to propagate
   size_t probagated;            // next trail position to probagate
   size_t probagated2;           // next binary trail position to probagate
+  size_t atmost_propagated;     // next trail position to count
+  size_t xor_propagated;        // next trail position to sum up
+  size_t target_assigned;       // size of trail saved in 'target_phases'
+  size_t best_assigned;         // size of trail saved in 'best_phases'
   vector<int> trail;            // assigned literals
   vector<int> clause;           // temporary in parsing & learning
   vector<int> levels;           // decision levels in learned clause
   vector<int> analyzed;         // analyzed literals in 'analyze'
   vector<int> minimized;        // removable or poison in 'minimize'
+  vector<int> shrinkable;       // block literals in 'shrink'
   vector<int> probes;           // remaining scheduled probes
   vector<Level> control;        // 'level + 1 == control.size ()'
+  vector<int> assumptions;      // assumed literals for next 'solve'
+  vector<int> projection;       // decided first during 'enumerate'
+  size_t projected;             // next projection candidate to decide
+  vector<int> objective;        // soft literals during 'optimize'
+  vector<int> guards;           // of 'backbone' and 'optimize'
+  vector<int> outputs;          // totalizer outputs during 'optimize'
+  Budget budget;                // of current 'solve' call
   vector<Clause*> clauses;      // ordered collection of all clauses
+  vector<Atmost*> constraints;  // cardinality constraints
+  vector<Xor*> xors;            // parity constraints
   ElimSchedule esched;          // bounded variable elimination schedule
+  ScoreSchedule scores;         // EVSIDS heap of unassigned variables
+  double score_inc;             // EVSIDS score increment
+  bool scoring;                 // EVSIDS scores instead of VMTF queue
   EMA fast_glue_avg;            // fast glue average
   EMA slow_glue_avg;            // slow glue average
   EMA size_avg;                 // learned clause size average
   EMA jump_avg;                 // jump average
+  struct { EMA fast_glue, slow_glue, size, jump; } saved_avg; // other mode
+  bool stable;                  // stable instead of focused mode
   double wg, ws;
   Limit lim;                    // limits for various phases
   Inc inc;                      // limit increments
@@ -156,6 +191,9 @@ class Internal {
   Arena arena;                  // memory arena for moving garbage collector
   Format error;                 // last (persistent) error message
   Clause binary_subsuming;      // communicate binary subsuming clause
+  Clause atmost_reason;         // place holder reason of 'atmost' units
+  Clause xor_reason;            // place holder reason of 'xor' units
+  vector<int> explanation;      // temporary in 'explain_atmost/xor'
   File * output;                // output file
 
   Internal * internal;          // proxy to 'this' in macros (redundant)
@@ -218,6 +256,7 @@ class Internal {
   Link & link (int lit)       { return ltab[vidx (lit)]; }
   Flags & flags (int lit)     { return ftab[vidx (lit)]; }
   long & bumped (int lit)     { return btab[vidx (lit)]; }
+  double & score (int lit)    { return stab[vidx (lit)]; }
   int & propfixed (int lit)   { return ptab[vlit (lit)]; }
 
   const Flags & flags (int lit) const { return ftab[vidx (lit)]; }
@@ -227,6 +266,8 @@ class Internal {
 
   Bins & bins (int lit) { assert (big); return big[vlit (lit)]; }
   Occs & occs (int lit) { assert (otab); return otab[vlit (lit)]; }
+  Atmosts & atmosts (int lit) { assert (atab); return atab[vlit (lit)]; }
+  Xors & xoccs (int lit) { assert (xtab); return xtab[vidx (lit)]; }
   long & noccs (int lit) { assert (ntab); return ntab[vlit (lit)]; }
   long & noccs2 (int lit) { assert (ntab2); return ntab2[vidx (lit)]; }
   Watches & watches (int lit) { assert (wtab); return wtab[vlit (lit)]; }
@@ -293,8 +334,34 @@ class Internal {
   void assign_driving (int lit, Clause * reason);
   void assign_decision (int decision);
   void assign_unit (int lit);
+  void propagate_atmosts ();
+  void propagate_xors ();
   bool propagate ();
 
+  // Native cardinality constraints in 'atmost.cpp'.
+  //
+  void init_atmosts ();
+  void reset_atmosts ();
+  void connect_atmosts ();
+  void add_atmost (const vector<int> & lits, int bound);
+  Clause * new_explanation_clause ();
+  Clause * explain_atmost (int lit);
+  void atmost_conflict (Atmost *);
+  void flush_atmosts ();
+
+  // Native parity constraints in 'xor.cpp'.
+  //
+  void init_xors ();
+  void reset_xors ();
+  void connect_xors ();
+  void add_xor (const vector<int> & lits);
+  Clause * explain_xor (int lit);
+  void xor_conflict (Xor *);
+  void flush_xors ();
+  void mark_garbage_xors (int idx);
+  void delete_garbage_xors ();
+  void delete_redundant_xors ();
+
   // Undo and restart in 'backtrack.cpp'.
   //
   void search_unassign (int lit);
@@ -304,6 +371,14 @@ class Internal {
   //
   bool minimize_literal (int lit, int depth = 0);
   void minimize_clause ();
+  void bin_minimize_clause ();
+
+  // Shrinking learned clauses to one literal per level in 'shrink.cpp'.
+  //
+  void mark_shrinkable (int lit, int & open);
+  void reset_shrinkable ();
+  int shrink_block (int_iterator begin, int_iterator end, int blevel);
+  void shrink_clause ();
 
   // Learning from conflicts in 'analyze.cc'.
   //
@@ -311,7 +386,17 @@ class Internal {
   void learn_unit_clause (int lit);
   void bump_variable (int lit);
   void bump_variables ();
+  int recompute_glue (Clause *);
   void bump_clause (Clause *);
+
+  // EVSIDS scores as alternative to the VMTF queue in 'score.cpp'.
+  //
+  void rescale_scores ();
+  void bump_score (int lit);
+  void bump_scores ();
+  void init_scores ();
+  void update_decision_heuristic ();
+
   void clear_seen ();
   void clear_levels ();
   void clear_minimized ();
@@ -324,12 +409,27 @@ class Internal {
   //
   bool restarting ();
   int reuse_trail ();
+  long next_reluctant ();
   void restart ();
 
+  // Switching between focused and stable mode in 'mode.cpp'.
+  //
+  bool stabilizing ();
+  void stabilize ();
+
   // Resetting the saved phased.
   bool rephasing ();
+  void update_target_and_best ();
   void rephase ();
 
+  // Local search for phases in 'walk.cpp'.
+  //
+  void walk ();
+
+  // User phase and decision priority hints in 'hint.cpp'.
+  void phase (int lit);
+  void prioritize (int lit);
+
   // Asynchronous terminating check.
   //
   bool terminating ();
@@ -467,6 +567,17 @@ class Internal {
   bool elim_round ();
   void elim ();
 
+  // Bounded variable addition in 'bva.cpp'.
+  //
+  int bva_tail_literal (Clause *, int lit);
+  int bva_other_literal (Clause *, int size);
+  void bva_mark_tail (Clause *, int lit);
+  void bva_unmark_tail (Clause *, int lit);
+  void bva_add_clause ();
+  void bva_replace (int lit, const vector<int> &, const vector<Clause*> &);
+  bool bva_literal (int lit);
+  void bva ();
+
   // Failed literal probing.
   //
   bool probing ();
@@ -492,18 +603,68 @@ class Internal {
   bool decompose_round ();
   void decompose ();
 
-  // Part on picking the next decision in 'decide.cpp'.
+  // Gaussian elimination on parity constraints in 'gauss.cpp'.
+  //
+  bool gaussing ();
+  void gauss_detect (vector<Xor*> &);
+  void gauss_add (int a, int b);
+  void gauss_keep (const vector<int> & vars, bool parity);
+  void gauss ();
+
+  // Part on picking the next decision in 'decide.cpp'.  As long not all
+  // assumptions are decided we can not be sure that all of them are
+  // satisfied even if all variables are assigned.
   //
-  bool satisfied () const { return trail.size () == (size_t) max_var; }
+  bool satisfied () const {
+    if ((size_t) level < assumptions.size ()) return false;
+    return trail.size () == (size_t) max_var;
+  }
   int next_decision_variable ();
+  int decide_phase (int idx);
+  int next_projected_variable ();
   void assume_decision (int decision);
-  void decide ();
+  int decide ();
+
+  // Variables frozen through the API or assumed in the current call must
+  // not be eliminated nor substituted.  The same applies to variables
+  // without external counter part (activation literals and variables
+  // added by bounded variable addition).
+  //
+  bool frozen (int lit) {
+    if (flags (lit).assumed) return true;
+    const int elit = externalize (lit);
+    return !elit || external->frozen (elit);
+  }
+
+  // Clauses with activation literals of pushed groups in 'group.cpp'.
+  //
+  bool grouping ();
+  bool grouped (Clause *);
+
+  // Bring back a removed variable in 'restore.cpp'.
+  //
+  void reactivate (int lit);
+
+  // Assumptions for the next call to 'solve' in 'assume.cpp'.  They stay
+  // valid until the next 'reset_assumptions' such that 'failed' can be
+  // queried after 'solve' returned '20'.
+  //
+  void assume (int lit);
+  void failing (int lit);
+  bool failed (int lit) const;
+  void reset_assumptions ();
+
+  // Decision based blocking of projected models in 'enumerate.cpp'.
+  //
+  void block_projected_model (int guard);
 
   // Main search functions in 'internal.cpp'.
   //
   int search ();                // CDCL loop
   void init_solving ();
-  int solve ();
+  void init_call_limits ();
+  bool collecting ();
+  int solve (bool resume = false);
 
 #ifndef QUIET
   // Built in profiling in 'profile.cpp'.
@@ -579,15 +740,13 @@ inline bool more_noccs2::operator () (int a, int b) {
   return a > b;
 }
 
-/*------------------------------------------------------------------------*/
-
-// Same here, e.g., we put this inlined function here such that we can
-// include the 'proof.hpp' header above without having 'Internal' yet.
+// Same for 'score_smaller' and the EVSIDS 'scores' heap.
 
-inline int Proof::externalize (int lit) {
-  int res = internal->externalize (lit);
-  assert (res);
-  return res;
+inline bool score_smaller::operator () (int a, int b) {
+  const double s = internal->score (a), t = internal->score (b);
+  if (s < t) return true;
+  if (s > t) return false;
+  return a > b;
 }
 
 };
@@ -0,0 +1,48 @@
+#include "ipasir.h"
+
+#include <config.hpp>
+
+// IPASIR on top of the C wrapper.  Only 'ipasir_val' differs, since it
+// returns the literal (or its negation) instead of '1' (or '-1').
+
+extern "C" {
+
+#include "ccadical.h"
+
+const char * ipasir_signature () { return "cadical-" CADICAL_VERSION; }
+
+void * ipasir_init () { return ccadical_init (); }
+
+void ipasir_release (void * solver) { ccadical_reset ((CCaDiCaL*) solver); }
+
+void ipasir_add (void * solver, int lit) {
+  ccadical_add ((CCaDiCaL*) solver, lit);
+}
+
+void ipasir_assume (void * solver, int lit) {
+  ccadical_assume ((CCaDiCaL*) solver, lit);
+}
+
+int ipasir_solve (void * solver) { return ccadical_sat ((CCaDiCaL*) solver); }
+
+int ipasir_val (void * solver, int lit) {
+  const int tmp = ccadical_deref ((CCaDiCaL*) solver, lit);
+  return tmp < 0 ? -lit : (tmp > 0 ? lit : 0);
+}
+
+int ipasir_failed (void * solver, int lit) {
+  return ccadical_failed ((CCaDiCaL*) solver, lit);
+}
+
+void ipasir_set_terminate (void * solver,
+                           void * state, int (*terminate)(void * state)) {
+  ccadical_set_terminate ((CCaDiCaL*) solver, state, terminate);
+}
+
+void ipasir_set_learn (void * solver,
+                       void * state, int max_length,
+                       void (*learn)(void * state, int * clause)) {
+  ccadical_set_learn ((CCaDiCaL*) solver, state, max_length, learn);
+}
+
+};
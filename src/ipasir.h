@@ -0,0 +1,28 @@
+#ifndef _ipasir_h_INCLUDED
+#define _ipasir_h_INCLUDED
+
+// Standard IPASIR interface for incremental SAT solvers, see for instance
+// the rules of the incremental track of the SAT Race 2015 for details.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+const char * ipasir_signature ();
+void * ipasir_init ();
+void ipasir_release (void * solver);
+void ipasir_add (void * solver, int lit);
+void ipasir_assume (void * solver, int lit);
+int ipasir_solve (void * solver);
+int ipasir_val (void * solver, int lit);
+int ipasir_failed (void * solver, int lit);
+void ipasir_set_terminate (void * solver,
+  void * state, int (*terminate)(void * state));
+void ipasir_set_learn (void * solver,
+  void * state, int max_length, void (*learn)(void * state, int * clause));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -9,14 +9,21 @@ namespace CaDiCaL {
 // on the 'control' stack.  The information gather here is used in
 // 'reuse_trail' and for early aborts in clause minimization.
 
+// Assumptions which are already satisfied when they are supposed to be
+// decided still get their own 'pseudo' decision level with a zero decision
+// literal.  Thus backtracking has to use the saved trail height instead of
+// searching for the decision literal on the trail.
+
 struct Level {
-  int decision;         // decision literal of level
+  int decision;         // decision literal of level (zero for pseudo)
+  int trail;            // trail height at decision
   int seen;             // how many variables seen during 'analyze'
-  int trail;            // smallest trail position seen
+  int earliest;         // smallest trail position seen
+  long stamp;           // used to count levels in 'recompute_glue'
 
-  void reset () { seen = 0, trail = INT_MAX; }
+  void reset () { seen = 0, earliest = INT_MAX; }
 
-  Level (int d) : decision (d) { reset (); }
+  Level (int d, int t) : decision (d), trail (t), stamp (0) { reset (); }
   Level () { }
 };
 
@@ -9,6 +9,14 @@ bool Internal::terminating () {
     LOG ("termination forced");
     return true;
   }
+  if (external->terminator && lim.terminate-- <= 0) {
+    lim.terminate = opts.terminateint;
+    if (external->terminated ()) {
+      LOG ("connected terminator forces termination");
+      termination = true;
+      return true;
+    }
+  }
   if (lim.conflict >= 0 && stats.conflicts >= lim.conflict) {
     LOG ("conflict limit %ld reached", lim.conflict);
     return true;
@@ -17,6 +25,11 @@ bool Internal::terminating () {
     LOG ("decision limit %ld reached", lim.decision);
     return true;
   }
+  if (lim.propagation >= 0 &&
+      stats.propagations.search >= lim.propagation) {
+    LOG ("propagation limit %ld reached", lim.propagation);
+    return true;
+  }
   return false;
 }
 
@@ -7,15 +7,19 @@ struct Limit {
 
   long conflict;  // conflict limit if non-negative
   long decision;  // decision limit if non-negative
+  long propagation; // search propagation limit if non-negative
 
   long elim;      // conflict limit for next 'elim'
   long probe;     // conflict limit for next 'probe'
   long reduce;    // conflict limit for next 'reduce'
   long rephase;   // conflict limit for next 'rephase'
   long restart;   // conflict limit for next 'restart'
+  long stabilize; // conflict limit for next mode switch
   long subsume;   // conflict limit for next 'subsume'
   long compact;   // conflict limit for next 'compact'
 
+  int terminate;  // calls to 'terminating' until polling terminator
+
   int keptglue;   // maximum kept glue in 'reduce'
   int keptsize;   // maximum kept size in 'reduce'
 
@@ -25,6 +29,12 @@ struct Limit {
   long subsumptions_at_last_elim;
   long      removed_at_last_elim;
 
+  // Used to schedule Gaussian elimination.
+  //
+  int         fixed_at_last_gauss;
+  int   substituted_at_last_gauss;
+  long        added_at_last_gauss;
+
   // Used to wait until and right after next 'reduce'.
   //
   long conflicts_at_last_reduce;
@@ -33,10 +43,14 @@ struct Limit {
   // literals during garbage collection would make sense or is required.
   //
   int fixed_at_last_collect;
+  long popped_groups_at_last_collect;
+  long popped_clauses_at_last_collect;
 
-  // Search propagation last time the inprocessor was called.
+  // Search ticks last time the inprocessor was called.
   //
-  struct { long transred, probe, vivify; } search_propagations;
+  struct {
+    long bva, elim, probe, subsume, transred, vivify, walk;
+  } search_ticks;
 
   Limit ();
 };
@@ -46,6 +60,8 @@ struct Inc {
   long redinc;  // reduce increment increment
   long subsume; // subsumption interval increment
   long rephase; // rephase interval
+  long stabilize; // length of focused and stable mode phases
+  struct { long u, v; } reluctant; // reluctant doubling sequence
   long compact; // compact interval increment
   long elim;    // elimination interval increment
   long probe;   // failed literal probing interval increment
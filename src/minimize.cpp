@@ -21,8 +21,10 @@ bool Internal::minimize_literal (int lit, int depth) {
   if (!v.reason || f.poison || v.level == level) return false;
   const Level & l = control[v.level];
   if (!depth && l.seen < 2) return false;         // Don Knuth's idea
-  if (v.trail <= l.trail) return false;           // new early abort
+  if (v.trail <= l.earliest) return false;        // new early abort
   if (depth > opts.minimizedepth) return false;
+  if (v.reason == &atmost_reason) explain_atmost (lit);
+  else if (v.reason == &xor_reason) explain_xor (lit);
   bool res = true;
   assert (v.reason);
   const_literal_iterator end = v.reason->end (), i;
@@ -37,25 +39,14 @@ bool Internal::minimize_literal (int lit, int depth) {
   return res;
 }
 
-// Sorting the clause before minimization with respect to the trail order
-// (literals with smaller trail height first) seems to be natural and could
-// help minimizing required recursion depth.   It might simplify the
-// algorithm too, but we still have to check that this as any effect in
-// practice (TODO).
-
-struct trail_assigned_smaller {
-  Internal * internal;
-  trail_assigned_smaller (Internal * s) : internal (s) { }
-  bool operator () (int a, int b) {
-    assert (internal->val (a)), assert (internal->val (b));
-    return internal->var (a).trail < internal->var (b).trail;
-  }
-};
+// The clause is sorted before minimization with respect to the trail order
+// (literals with smaller trail height first, see 'analyze'), which seems to
+// be natural, could help minimizing required recursion depth and is needed
+// for shrinking afterwards anyhow (see 'shrink.cpp').
 
 void Internal::minimize_clause () {
   START (minimize);
   LOG (clause, "minimizing first UIP clause");
-  sort (clause.begin (), clause.end (), trail_assigned_smaller (this));
   assert (minimized.empty ());
   int_iterator j = clause.begin ();
   for (const_int_iterator i = j; i != clause.end (); i++)
@@ -68,6 +59,53 @@ void Internal::minimize_clause () {
   STOP (minimize);
 }
 
+// After minimization and shrinking the learned clause might still contain
+// literals which are implied through a binary clause by the asserting
+// literal.  If '(uip | other)' is a binary clause and '-other' is in the
+// learned clause, then self-subsuming resolution on 'other' removes '-other'
+// from the learned clause.  The resulting clause is still RUP, since
+// propagating the negation of the asserting literal over the binary clause
+// falsifies the removed literal again, thus no additional proof steps are
+// required.  With marking this is linear in the clause size and the number
+// of watches of the asserting literal, which is the last literal in the
+// clause (sorted with respect to the trail).
+
+void Internal::bin_minimize_clause () {
+  assert (clause.size () > 1);
+  START (minimize);
+  const int uip = clause.back ();
+  assert (var (uip).level == level);
+  const const_int_iterator end = clause.end () - 1;
+  const_int_iterator i;
+  for (i = clause.begin (); i != end; i++) mark (*i);
+  const Watches & ws = watches (uip);
+  const const_watch_iterator eow = ws.end ();
+  long removed = 0;
+  for (const_watch_iterator w = ws.begin (); w != eow; w++) {
+    if (!w->binary) continue;
+    const int other = w->blit;
+    if (marked (-other) <= 0) continue;
+    LOG ("binary clause %d %d removes %d", uip, other, -other);
+    unmark (-other);
+    removed++;
+  }
+  int_iterator j = clause.begin ();
+  for (i = j; i != end; i++) {
+    const int lit = *i;
+    if (marked (lit) <= 0) continue;
+    unmark (lit);
+    *j++ = lit;
+  }
+  *j++ = uip;
+  clause.resize (j - clause.begin ());
+  if (removed) {
+    LOG ("binary minimization removed %ld literals", removed);
+    stats.binminimized += removed;
+    external->check_learned_clause ();
+  }
+  STOP (minimize);
+}
+
 void Internal::clear_minimized () {
   const_int_iterator i;
   for (i = minimized.begin (); i != minimized.end (); i++) {
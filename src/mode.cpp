@@ -0,0 +1,46 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Search alternates between a focused mode and a stable mode.  In focused
+// mode decisions are taken from the VMTF queue and restarts are triggered
+// aggressively by the glue averages (see 'restarting').  In stable mode
+// decisions follow EVSIDS scores (see 'score.cpp') and restarts are rare,
+// following the reluctant doubling sequence (see 'restart').  Focused mode
+// helps on unsatisfiable instances, while stable mode is much better at
+// finding models of satisfiable instances.
+
+// Both modes are run for the same number of conflicts, starting with
+// 'stabilizeinit' conflicts, which is multiplied by 'stabilizefactor'
+// percent after each stable phase.  Each mode has its own glue, size and
+// jump averages, which are swapped with the saved ones when switching.
+
+bool Internal::stabilizing () {
+  if (!opts.stabilize) return stable;
+  return stats.conflicts > lim.stabilize;
+}
+
+void Internal::stabilize () {
+  backtrack ();
+  stable = !stable;
+  swap (fast_glue_avg, saved_avg.fast_glue);
+  swap (slow_glue_avg, saved_avg.slow_glue);
+  swap (size_avg, saved_avg.size);
+  swap (jump_avg, saved_avg.jump);
+  update_decision_heuristic ();
+  if (stable) {
+    stats.stable.phases++;
+    LOG ("switching to stable mode %ld", stats.stable.phases);
+    inc.reluctant.u = inc.reluctant.v = 1;
+    lim.restart = stats.conflicts + opts.reluctant * next_reluctant ();
+  } else {
+    LOG ("switching to focused mode");
+    lim.restart = stats.conflicts + opts.restartint;
+    inc.stabilize = inc.stabilize * (opts.stabilizefactor / 100.0);
+  }
+  lim.stabilize = stats.conflicts + inc.stabilize;
+  LOG ("next mode switch after %ld conflicts", lim.stabilize);
+  report (stable ? '[' : ']');
+}
+
+};
@@ -0,0 +1,223 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Core-guided weighted MaxSAT following the OLL algorithm.  Soft literals
+// with remaining weight are assumed.  If this is unsatisfiable the failed
+// soft literals form a core, of which at least one is falsified in every
+// model.  The minimum weight of the core is added to the lower bound and
+// subtracted from all core literals.  Then a totalizer counting the
+// falsified core literals is added, whose outputs 'o_k' mean that at least
+// 'k' core literals are falsified.  Since 'o_1' is implied by the core, the
+// negation of 'o_2' becomes a new soft literal with the minimum weight.  If
+// later the soft literal '-o_k' is found in a core, then '-o_{k+1}' is
+// added as soft literal too.  All soft literals are kept in the internal
+// 'objective', which is mapped during 'compact'.
+
+// Weight stratification only assumes soft literals with at least the weight
+// 'threshold', which is lowered on satisfiable calls.  These calls give
+// models and thus upper bounds early.  If all soft literals are assumed
+// and the call is satisfiable, the model is optimal.
+
+// All totalizer clauses contain the negation of a fresh 'guard' literal,
+// which is assumed first.  At the end the guard is falsified, which makes
+// all these clauses and clauses learned from them root level satisfied.
+// They are then collected as with popped groups.  The totalizer outputs
+// are internal variables too, which are never eliminated (see 'frozen').
+// Thus they are falsified at the end as well, such that 'compact' removes
+// them.  Since 'compact' changes internal literals the guard and outputs
+// are kept in the internal 'guards' and 'outputs' and the user assumptions
+// are kept as external literals.
+
+struct Soft {
+  size_t pos;           // position of soft literal in 'objective'
+  long weight;          // remaining weight
+  int totalizer;        // index of totalizer of '-o_k' or negative
+  bool extended;        // '-o_{k+1}' has been added
+  Soft (size_t p, long w, int t) :
+    pos (p), weight (w), totalizer (t), extended (false) { }
+};
+
+struct Totalizer {
+  size_t last;          // position of last soft literal '-o_n'
+  long weight;          // minimum weight of the core
+  Totalizer (size_t l, long w) : last (l), weight (w) { }
+};
+
+// Builds a totalizer with 'outputs[k-1]' implied if at least 'k' of the
+// 'inputs' are true, which is the only direction needed.
+
+void External::totalize (const vector<int> & inputs, vector<int> & outputs,
+                         int guard) {
+  assert (!inputs.empty ());
+  if (inputs.size () == 1) { outputs = inputs; return; }
+  const size_t half = inputs.size () / 2;
+  vector<int> left, right, a, b;
+  left.assign (inputs.begin (), inputs.begin () + half);
+  right.assign (inputs.begin () + half, inputs.end ());
+  totalize (left, a, guard);
+  totalize (right, b, guard);
+  outputs.clear ();
+  for (size_t k = 0; k < inputs.size (); k++) {
+    const int output = new_activation_variable ();
+    internal->outputs.push_back (output);
+    outputs.push_back (output);
+  }
+  internal->stats.optimize.outputs += outputs.size ();
+  for (size_t i = 0; i <= a.size (); i++)
+    for (size_t j = 0; j <= b.size (); j++) {
+      if (!i && !j) continue;
+      internal->add_original_lit (-guard);
+      if (i) internal->add_original_lit (-a[i - 1]);
+      if (j) internal->add_original_lit (-b[j - 1]);
+      internal->add_original_lit (outputs[i + j - 1]);
+      internal->add_original_lit (0);
+    }
+}
+
+int External::optimize (const vector<int> & elits,
+                        const vector<long> & weights,
+                        long & cost, Bounder * bounder) {
+
+  assert (elits.size () == weights.size ());
+  reset_assumptions ();
+  interrupted = false;
+
+  vector<int> assumed;
+  const const_int_iterator end = internal->assumptions.end ();
+  for (const_int_iterator i = internal->assumptions.begin (); i != end; i++)
+    assumed.push_back (internal->externalize (*i));
+  const size_t n = elits.size ();
+  LOG ("optimizing %ld soft literals", (long) n);
+
+  for (size_t i = 0; i < n; i++) freeze (elits[i]);
+  vector<int> & objective = internal->objective;
+  assert (objective.empty ());
+  vector<Soft> softs;
+  vector<Totalizer> totalizers;
+  long lower = 0, upper = -1;
+  for (size_t i = 0; i < n; i++) {
+    assert (weights[i] > 0);
+    objective.push_back (internalize (elits[i]));
+    softs.push_back (Soft (i, weights[i], -1));
+  }
+  vector<int> & guards = internal->guards;
+  guards.push_back (new_activation_variable ());
+  vector<signed char> best;
+  internal->budget = Budget ();
+
+  long threshold = 0;
+  for (size_t i = 0; i < n; i++)
+    if (weights[i] > threshold) threshold = weights[i];
+
+  int res;
+  for (;;) {
+
+    internal->reset_assumptions ();
+    const const_int_iterator eoa = assumed.end ();
+    for (const_int_iterator i = assumed.begin (); i != eoa; i++)
+      internal->assume (internalize (*i));
+    activate ();
+    internal->assume (guards.back ());
+    bool complete = true;
+    for (size_t i = 0; i < softs.size (); i++) {
+      const Soft & s = softs[i];
+      if (!s.weight) continue;
+      if (s.weight >= threshold) internal->assume (objective[s.pos]);
+      else complete = false;
+    }
+
+    res = internal->solve ();
+    if (!res) break;
+
+    if (res == 10) {
+      long tmp = 0;
+      for (size_t i = 0; i < n; i++)
+        if (internal->val (objective[i]) < 0) tmp += weights[i];
+      LOG ("model of cost %ld", tmp);
+      if (upper < 0 || tmp < upper) {
+        internal->stats.optimize.models++;
+        upper = tmp;
+        extend ();
+        if (internal->opts.check) check (&External::val);
+        best.assign (vals, vals + max_var + 1);
+        if (bounder) bounder->bounds (lower, upper);
+      }
+      if (complete || upper == lower) { lower = upper; break; }
+      long next = 0;
+      for (size_t i = 0; i < softs.size (); i++) {
+        const long w = softs[i].weight;
+        if (w < threshold && w > next) next = w;
+      }
+      LOG ("lowering stratification threshold to %ld", next);
+      threshold = next;
+      continue;
+    }
+
+    assert (res == 20);
+    vector<size_t> core;
+    long minimum = 0;
+    for (size_t i = 0; i < softs.size (); i++) {
+      const Soft & s = softs[i];
+      if (!s.weight || s.weight < threshold) continue;
+      if (!internal->failed (objective[s.pos])) continue;
+      core.push_back (i);
+      if (!minimum || s.weight < minimum) minimum = s.weight;
+    }
+    if (core.empty ()) {
+      LOG ("hard clauses unsatisfiable");
+      break;
+    }
+    internal->stats.optimize.cores++;
+    lower += minimum;
+    LOG ("core of size %ld and weight %ld gives lower bound %ld",
+      (long) core.size (), minimum, lower);
+    if (bounder) bounder->bounds (lower, upper);
+    if (upper >= 0 && lower >= upper) { lower = upper; res = 10; break; }
+
+    vector<int> inputs;
+    for (size_t i = 0; i < core.size (); i++) {
+      Soft & s = softs[core[i]];
+      s.weight -= minimum;
+      inputs.push_back (-objective[s.pos]);
+      if (s.totalizer < 0 || s.extended) continue;
+      s.extended = true;
+      const Totalizer & t = totalizers[s.totalizer];
+      if (s.pos == t.last) continue;
+      softs.push_back (Soft (s.pos + 1, t.weight, s.totalizer));
+    }
+    if (inputs.size () == 1) continue;
+
+    vector<int> outputs;
+    totalize (inputs, outputs, guards.back ());
+    const size_t first = objective.size ();
+    for (size_t k = 0; k < outputs.size (); k++)
+      objective.push_back (-outputs[k]);
+    const int t = (int) totalizers.size ();
+    totalizers.push_back (Totalizer (objective.size () - 1, minimum));
+    softs.push_back (Soft (first + 1, minimum, t));
+  }
+
+  internal->add_original_lit (-guards.back ());
+  internal->add_original_lit (0);
+  guards.pop_back ();
+  const const_int_iterator eoo = internal->outputs.end ();
+  for (const_int_iterator i = internal->outputs.begin (); i != eoo; i++) {
+    internal->add_original_lit (-*i);
+    internal->add_original_lit (0);
+  }
+  internal->outputs.clear ();
+  internal->objective.clear ();
+  for (size_t i = 0; i < n; i++) melt (elits[i]);
+
+  cost = upper;
+  if (upper >= 0) {
+    if (res == 20) res = 10;
+    for (int eidx = 1; eidx <= max_var; eidx++) vals[eidx] = best[eidx];
+  }
+  LOG ("optimization result %d with cost %ld", res, cost);
+  solved = true;
+  return res;
+}
+
+};
@@ -44,73 +44,110 @@
 OPTION(arena,            int,    3, 0,  3, "1=clause,2=var,3=queue") \
 OPTION(arenacompact,    bool,    1, 0,  1, "keep clauses compact") \
 OPTION(arenasort,        int,    1, 0,  1, "sort clauses after arenaing") \
+OPTION(backbonechunk,    int,   64, 1,1e5, "maximum backbone chunk size") \
 OPTION(binary,          bool,    1, 0,  1, "use binary proof format") \
+OPTION(bva,             bool,    1, 0,  1, "bounded variable addition") \
+OPTION(bvareleff,     double, 0.02, 0,  1, "relative efficiency") \
+OPTION(bvamaxeff,     double,  1e8, 0,1e9, "maximum efficiency") \
+OPTION(bvamineff,     double,  1e6, 0,1e9, "minimum efficiency") \
 OPTION(check,           bool,DEBUG, 0,  1, "save & check original CNF") \
-OPTION(clim,             int,   -1, 0,1e9, "conflict limit (-1=none)") \
+OPTION(clim,             int,   -1,-1,1e9, "conflict limit (-1=none)") \
 OPTION(compact,         bool,    1, 0,  1, "enable compactification") \
 OPTION(compactint,       int,  1e3, 1,1e9, "compactification conflic tlimit") \
 OPTION(compactlim,    double,  0.1, 0,  1, "inactive variable limit") \
 OPTION(compactmin,       int,  100, 1,1e9, "inactive variable limit") \
-OPTION(dlim,             int,   -1, 0,1e9, "decision limit (-1=none)") \
+OPTION(core,            bool,    0, 0,  1, "add selectors for clause cores") \
+OPTION(decompose,       bool,    1, 0,  1, "SCC decompose BIG and ELS") \
+OPTION(decomposerounds,  int,    1, 1,1e9, "number of decompose rounds") \
+OPTION(dlim,             int,   -1,-1,1e9, "decision limit (-1=none)") \
 OPTION(elim,            bool,    1, 0,  1, "bounded variable elimination") \
 OPTION(elimclslim,       int,  1e3, 0,1e9, "ignore clauses of this size") \
 OPTION(eliminit,         int,  1e3, 0,1e9, "initial conflict limit") \
 OPTION(elimint,          int,  1e4, 1,1e9, "initial conflict interval") \
+OPTION(elimmaxeff,    double,  1e9, 0,1e9, "maximum efficiency") \
+OPTION(elimmineff,    double,  1e7, 0,1e9, "minimum efficiency") \
 OPTION(elimocclim,       int,  100, 0,1e9, "one sided occurrence limit") \
+OPTION(elimreleff,    double, 0.10, 0,  1, "relative efficiency") \
 OPTION(elimroundsinit,   int,    5, 1,1e9, "initial number of rounds") \
 OPTION(elimrounds,       int,    2, 1,1e9, "usual number of rounds") \
 OPTION(emagluefast,   double, 3e-2, 0,  1, "alpha fast glue") \
 OPTION(emaglueslow,   double, 1e-5, 0,  1, "alpha slow glue") \
 OPTION(emajump,       double, 1e-5, 0,  1, "alpha jump level") \
 OPTION(emasize,       double, 1e-5, 0,  1, "alpha learned clause size") \
-OPTION(decompose,       bool,    1, 0,  1, "SCC decompose BIG and ELS") \
-OPTION(decomposerounds,  int,    1, 1,1e9, "number of decompose rounds") \
+OPTION(enumeratekeep,   bool,    0, 0,  1, "keep blocking clauses") \
 OPTION(force,           bool,    0, 0,  1, "force to read broken header") \
+OPTION(gauss,           bool,    1, 0,  1, "Gaussian elimination") \
+OPTION(gausskeep,        int,   64, 0,1e9, "maximum size of kept rows") \
+OPTION(gaussmaxeff,   double,  1e7, 0,1e9, "maximum word operations") \
+OPTION(gaussmaxsize,     int,    5, 3,  6, "maximum detected size") \
+OPTION(gaussocclim,      int,  100, 0,1e9, "occurrence list limit") \
 OPTION(hbr,             bool,    1, 0,  1, "learn hyper binary clauses") \
 OPTION(hbrsizelim,       int, 1e9, 3, 1e9, "max size HBR base clause") \
-OPTION(keepglue,         int,    3, 1,1e9, "glue kept learned clauses") \
+OPTION(keepglue,         int,    2, 1,1e9, "glue kept learned clauses") \
 OPTION(keepsize,         int,    3, 2,1e9, "size kept learned clauses") \
 OPTION(leak,            bool,    1, 0,  1, "leak solver memory") \
 LOGOPT(log,             bool,    0, 0,  1, "enable logging") \
 LOGOPT(logsort,         bool,    0, 0,  1, "sort logged clauses") \
 OPTION(minimize,        bool,    1, 0,  1, "minimize learned clauses") \
+OPTION(minimizebin,     bool,    1, 0,  1, "minimize with binary clauses") \
+OPTION(minimizebinglue,  int,    6, 0,1e9, "maximum glue for binary minimization") \
 OPTION(minimizedepth,    int,  1e3, 0,1e9, "minimization depth") \
 OPTION(phase,            int,    1, 0,  1, "initial phase: 0=neg,1=pos") \
+OPTION(plim,             int,   -1,-1,1e9, "propagation limit (-1=none)") \
+OPTION(poplim,        double,  0.1, 0,  1, "popped clauses collection limit") \
 OPTION(posize,           int,    4, 4,1e9, "size for saving position") \
 OPTION(prefetch,        bool,    1, 0,  1, "prefetch watches") \
 OPTION(probe,           bool,    1, 0,  1, "failed literal probing" ) \
 OPTION(probeinit,        int,  500, 0,1e9, "initial probing interval" ) \
 OPTION(probeint,         int,  1e4, 1,1e9, "probing interval increment" ) \
 OPTION(probereleff,   double, 0.02, 0,  1, "relative probing efficiency") \
-OPTION(probemaxeff,   double,  1e7, 0,  1, "maximum probing efficiency") \
-OPTION(probemineff,   double,  1e5, 0,  1, "minimum probing efficiency") \
+OPTION(probemaxeff,   double,  1e8, 0,1e9, "maximum probing efficiency") \
+OPTION(probemineff,   double,  1e6, 0,1e9, "minimum probing efficiency") \
 OPTION(profile,          int,    2, 0,  4, "profiling level") \
 QUTOPT(quiet,           bool,    0, 0,  1, "disable all messages") \
 OPTION(reduceinc,        int,  300, 1,1e6, "reduce limit increment") \
 OPTION(reduceinit,       int, 2000, 0,1e6, "initial reduce limit") \
+OPTION(reducetier2,      int,    6, 1,1e9, "glue of tier-two learned clauses") \
+OPTION(reluctant,        int, 1024, 1,1e9, "stable restart base interval") \
+OPTION(reluctantmax,     int,  1e6, 1,1e9, "stable restart maximum interval") \
 OPTION(rephase,         bool,    1, 0,  1, "enable rephasing") \
-OPTION(rephaseint,       int,  1e5, 1,1e9, "rephasing interval") \
+OPTION(rephaseint,       int,  1e3, 1,1e9, "rephasing interval increment") \
 OPTION(restart,         bool,    1, 0,  1, "enable restarting") \
 OPTION(restartint,       int,    6, 1,1e9, "restart base interval") \
 OPTION(restartmargin, double,  1.1, 0, 10, "restart slow fast margin") \
 OPTION(reusetrail,      bool,    1, 0,  1, "enable trail reuse") \
+OPTION(shrink,          bool,    1, 0,  1, "shrink learned clauses per level") \
 OPTION(simplify,        bool,    1, 0,  1, "enable simplifier") \
+OPTION(stabilize,       bool,    1, 0,  1, "alternate focused and stable mode") \
+OPTION(stabilizefactor,  int,  200,101,1e4, "mode phase length increase in percent") \
+OPTION(stabilizeinit,    int,  1e3, 1,1e9, "initial mode phase length") \
 OPTION(strengthen,      bool,    1, 0,  1, "strengthen during subsume") \
 OPTION(subsume,         bool,    1, 0,  1, "enable clause subsumption") \
 OPTION(subsumebinlim,    int,  1e4, 0,1e9, "watch list length limit") \
 OPTION(subsumeclslim,    int,  1e3, 0,1e9, "clause length limit") \
 OPTION(subsumeinc,       int,  1e4, 1,1e9, "interval in conflicts") \
 OPTION(subsumeinit,      int,  1e4, 0,1e9, "initial subsume limit") \
+OPTION(subsumemaxeff, double,  1e9, 0,1e9, "maximum efficiency") \
+OPTION(subsumemineff, double,  1e7, 0,1e9, "minimum efficiency") \
 OPTION(subsumeocclim,    int,  100, 0,1e9, "watch list length limit") \
+OPTION(subsumereleff, double, 0.10, 0,  1, "relative efficiency") \
+OPTION(target,           int,    1, 0,  2, "target phases (1=stable only)") \
+OPTION(terminateint,     int,   10, 0,1e4, "terminator poll interval") \
 OPTION(transred,        bool,    1, 0,  1, "transitive reduction of BIG") \
 OPTION(transredreleff,double, 0.10, 0,  1, "relative efficiency") \
-OPTION(transredmaxeff,double,  1e7, 0,  1, "maximum efficiency") \
-OPTION(transredmineff,double,  1e5, 0,  1, "minimum efficiency") \
+OPTION(transredmaxeff,double,  1e8, 0,1e9, "maximum efficiency") \
+OPTION(transredmineff,double,  1e6, 0,1e9, "minimum efficiency") \
 QUTOPT(verbose,         int,     0, 0,  2, "more verbose messages") \
+OPTION(vsids,          bool,    0, 0,  1, "EVSIDS instead of VMTF decisions") \
+OPTION(vsidsdecay,   double, 0.95,0.5,0.999,"EVSIDS score decay") \
 OPTION(vivify,          bool,    1, 0,  1, "vivification") \
 OPTION(vivifyreleff,  double, 0.03, 0,  1, "relative efficiency") \
-OPTION(vivifymaxeff,  double,  1e7, 0,  1, "maximum efficiency") \
-OPTION(vivifymineff,  double,  1e5, 0,  1, "minimum efficiency") \
+OPTION(vivifymaxeff,  double,  1e8, 0,1e9, "maximum efficiency") \
+OPTION(vivifymineff,  double,  1e6, 0,1e9, "minimum efficiency") \
+OPTION(walk,            bool,    1, 0,  1, "local search during rephase") \
+OPTION(walkreleff,    double, 0.02, 0,  1, "relative efficiency") \
+OPTION(walkmaxeff,    double,  1e8, 0,1e9, "maximum efficiency") \
+OPTION(walkmineff,    double,  1e6, 0,1e9, "minimum efficiency") \
 OPTION(witness,         bool,    1, 0,  1, "print witness") \
 
 /*------------------------------------------------------------------------*/
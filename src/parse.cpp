@@ -68,7 +68,7 @@ Parser::parse_lit (int & ch, int & lit, const int vars) {
 // Parsing function for CNF in DIMACS format.
 
 const char * Parser::parse_dimacs_non_profiled () {
-  int ch, vars = 0, clauses = 0;
+  int ch;
   for (;;) {
     ch = parse_char ();
     if (ch != 'c') break;
@@ -84,7 +84,20 @@ const char * Parser::parse_dimacs_non_profiled () {
     if (*o) internal->opts.set (o);
   }
   if (ch != 'p') PER ("expected 'c' or 'p'");
-  const char * err = parse_string (" cnf ", 'p');
+  if ((ch = parse_char ()) != ' ') PER ("expected ' ' after 'p'");
+  if ((ch = parse_char ()) == 'i') {
+    const char * err = parse_string ("nccnf", 'i');
+    if (err) return err;
+    while ((ch = parse_char ()) == ' ' || ch == '\r')
+      ;
+    if (ch != '\n') PER ("expected new-line after 'p inccnf'");
+    MSG ("found 'p inccnf' header");
+    inccnf = true;
+    vars = INT_MAX;
+    return 0;
+  }
+  if (ch != 'c') PER ("expected 'cnf' or 'inccnf' after 'p '");
+  const char * err = parse_string ("nf ", 'c');
   if (err) return err;
   if (!isdigit (ch = parse_char ())) PER ("expected digit after 'p cnf '");
   err = parse_positive_int (ch, vars, "<max-var>");
@@ -99,7 +112,19 @@ const char * Parser::parse_dimacs_non_profiled () {
     PER ("expected new-line after 'p cnf %d %d'", vars, clauses);
   MSG ("found 'p cnf %d %d' header", vars, clauses);
   external->init (vars);
-  int lit = 0, parsed = 0;
+  bool assumed;
+  return parse_query_non_profiled (assumed);
+}
+
+// Parse clauses until end-of-file or, in incremental mode, until the end of
+// the next assumption line.  Parsing of an assumption line can only start
+// after a complete clause and thus parsing can later be resumed in a
+// fresh call to this function without keeping any other state.
+
+const char * Parser::parse_query_non_profiled (bool & assumed) {
+  int ch, lit = 0;
+  const char * err;
+  assumed = false;
   while ((ch = parse_char ()) != EOF) {
     if (ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r') continue;
     if (ch == 'c') {
@@ -108,11 +133,26 @@ COMMENT:
         if (ch == EOF) PER ("unexpected end-of-file in body comment");
       continue;
     }
+    if (inccnf && ch == 'a') {
+      if (lit) PER ("unexpected assumption line within clause");
+      if ((ch = parse_char ()) != ' ') PER ("expected ' ' after 'a'");
+      for (;;) {
+        ch = parse_char ();
+        if (ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r') continue;
+        err = parse_lit (ch, lit, vars);
+        if (err) return err;
+        if (ch == 'c') PER ("unexpected comment in assumption line");
+        if (!lit) break;
+        external->assume (lit);
+      }
+      assumed = true;
+      return 0;
+    }
     err = parse_lit (ch, lit, vars);
     if (err) return err;
     if (ch == 'c') goto COMMENT;
     external->add (lit);
-    if (!lit && parsed++ >= clauses && !internal->opts.force)
+    if (!lit && parsed++ >= clauses && !inccnf && !internal->opts.force)
       PER ("too many clauses");
   }
   if (lit) PER ("last clause without '0'");
@@ -167,6 +207,31 @@ const char * Parser::parse_solution_non_profiled () {
   return 0;
 }
 
+// Parsing function for phases, either as plain literals or in competition
+// output format.
+
+const char * Parser::parse_phases_non_profiled () {
+  int ch = parse_char (), count = 0;
+  while (ch != EOF) {
+    if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == 'v') {
+      ch = parse_char ();
+    } else if (ch == 'c' || ch == 's') {
+      while ((ch = parse_char ()) != '\n')
+        if (ch == EOF) PER ("unexpected end-of-file in comment");
+    } else {
+      int lit = 0;
+      const char * err = parse_lit (ch, lit, external->max_var);
+      if (err) return err;
+      if (ch == 'c') PER ("unexpected comment");
+      if (!lit) continue;
+      external->phase (lit);
+      count++;
+    }
+  }
+  MSG ("parsed %d phases %.2f%%", count, percent (count, external->max_var));
+  return 0;
+}
+
 /*------------------------------------------------------------------------*/
 
 // Wrappers to profile parsing and at the same time use the convenient
@@ -179,6 +244,14 @@ const char * Parser::parse_dimacs () {
   return err;
 }
 
+const char * Parser::parse_query (bool & assumed) {
+  assert (inccnf);
+  START (parse);
+  const char * err = parse_query_non_profiled (assumed);
+  STOP (parse);
+  return err;
+}
+
 const char * Parser::parse_solution () {
   START (parse);
   const char * err = parse_solution_non_profiled ();
@@ -186,4 +259,11 @@ const char * Parser::parse_solution () {
   return err;
 }
 
+const char * Parser::parse_phases () {
+  START (parse);
+  const char * err = parse_phases_non_profiled ();
+  STOP (parse);
+  return err;
+}
+
 };
@@ -17,6 +17,11 @@ class Parser {
   External * external;
   File * file;
 
+  int vars;             // maximum variable index in header
+  int clauses;          // number of clauses in header
+  int parsed;           // number of clauses parsed so far
+  bool inccnf;          // incremental CNF with 'p inccnf' header
+
   void perr (const char * fmt, ...);
   int parse_char ();
 
@@ -24,19 +29,33 @@ class Parser {
   const char * parse_positive_int (int & ch, int & res, const char * name);
   const char * parse_lit (int & ch, int & lit, const int vars);
   const char * parse_dimacs_non_profiled ();
+  const char * parse_query_non_profiled (bool & assumed);
   const char * parse_solution_non_profiled ();
+  const char * parse_phases_non_profiled ();
 
 public:
 
   Parser (Internal * i, External * e, File * f)
-  : internal (i), external (e), file (f)
+  : internal (i), external (e), file (f),
+    vars (0), clauses (0), parsed (0), inccnf (false)
   { }
 
   // Parse a DIMACS file.  Return zero if successful. Otherwise parse error.
-  // The clauses are added.
+  // The clauses are added.  For incremental CNF (iCNF) files with a
+  // 'p inccnf' header only the header is parsed (see 'parse_query').
   //
   const char * parse_dimacs ();
 
+  bool incremental () const { return inccnf; }
+
+  // Parse the next query of an incremental CNF (iCNF) file, e.g., add the
+  // clauses up to the next assumption line 'a <lit> ... 0' and assume the
+  // literals of that line.  Returns zero if successful, in which case
+  // 'assumed' is false if end-of-file was reached instead.  Otherwise a
+  // parse error is returned.
+  //
+  const char * parse_query (bool & assumed);
+
   // Parse a solution file as used in the SAT competition, e.g., with
   // comment lines 'c ...', a status line 's ...' and value lines 'v ...'.
   // Returns zero if successful. Otherwise a string is returned describing
@@ -44,6 +63,13 @@ public:
   // accessed with 'sol (int lit)'.  We use it for checking learned clauses.
   //
   const char * parse_solution ();
+
+  // Parse a file of literals which set the saved phases of their variables.
+  // Comment lines 'c ...' and status lines 's ...' are skipped and a 'v'
+  // at the start of a line is ignored, such that solution files can be used
+  // as well as plain lists of literals.
+  //
+  const char * parse_phases ();
 };
 
 };
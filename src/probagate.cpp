@@ -188,6 +188,7 @@ void Internal::probagate2 () {
     const int lit = -trail[probagated2++];
     LOG ("probagating %d over binary clauses", -lit);
     Watches & ws = watches (lit);
+    stats.ticks.probe += 1 + cache_lines (ws.size (), sizeof (Watch));
     const_watch_iterator i = ws.begin ();
     watch_iterator j = ws.begin ();
     while (!conflict && i != ws.end ()) {
@@ -208,7 +209,7 @@ bool Internal::probagate () {
 
   START (propagate);
 
-  long before = probagated2;
+  long before = probagated2, ticks = 0;
 
   while (!conflict) {
     if (probagated2 < trail.size ()) probagate2 ();
@@ -216,12 +217,14 @@ bool Internal::probagate () {
       const int lit = -trail[probagated++];
       LOG ("probagating %d over large clauses", -lit);
       Watches & ws = watches (lit);
+      ticks += 1 + cache_lines (ws.size (), sizeof (Watch));
       size_t i = 0, j = 0;
       while (i != ws.size ()) {
         const Watch w = ws[j++] = ws[i++];
         if (w.binary) continue;
         const int b = val (w.blit);
         if (b > 0) continue;
+        ticks++;
         if (w.clause->garbage) continue;
         literal_iterator lits = w.clause->begin ();
 	const int other = lits[0]^lits[1]^lit;
@@ -274,6 +277,7 @@ bool Internal::probagate () {
   }
   long delta = probagated2 - before;
   stats.propagations.probe += delta;
+  stats.ticks.probe += ticks;
   if (conflict) LOG (conflict, "conflict");
   STOP (propagate);
   return !conflict;
@@ -173,21 +173,22 @@ void Internal::probe_core () {
   assert (unsat || propagated == trail.size ());
   probagated = probagated2 = trail.size ();
 
-  // Probing is limited in terms of non-probing propagations
-  // 'stats.propagations'. We allow a certain percentage 'opts.probereleff'
-  // (say %5) of probing propagations (called 'probagations') in each
-  // probing with a lower bound of 'opts.probmineff'.
+  // Probing is limited in terms of search 'ticks' since the last probing.
+  // We allow a certain percentage 'opts.probereleff' (say %2) of these as
+  // probing ticks in each probing with a lower bound of 'opts.probmineff'.
+  // Ticks (see 'propagate') measure actual memory accesses, which in the
+  // presence of huge watch lists are not well represented by propagations.
   //
-  long delta = stats.propagations.search;
-  delta -= lim.search_propagations.probe;
+  long delta = stats.ticks.search;
+  delta -= lim.search_ticks.probe;
   delta *= opts.probereleff;
   if (delta < opts.probemineff) delta = opts.probemineff;
   if (delta > opts.probemaxeff) delta = opts.probemaxeff;
-  long limit = stats.propagations.probe + delta;
+  long limit = stats.ticks.probe + delta;
 
   int probe;
   while (!unsat &&
-         stats.propagations.probe < limit &&
+         stats.ticks.probe < limit &&
          (probe = next_probe ())) {
     stats.probed++;
     LOG ("probing %d", probe);
@@ -218,7 +219,7 @@ void Internal::probe_core () {
   else inc.probe += opts.probeint;
   lim.probe = stats.conflicts + inc.probe;
 
-  lim.search_propagations.probe = stats.propagations.search;
+  lim.search_ticks.probe = stats.ticks.search;
 
   VRB ("probe", stats.probings,
     "probed %ld and found %d failed literals",
@@ -231,7 +232,8 @@ void CaDiCaL::Internal::probe () {
   SWITCH_AND_START (search, simplify, probe);
   if (level) backtrack ();
   assert (!unsat);
-  decompose ();
+  gauss ();
+  if (!unsat) decompose ();
   if (!unsat) {
     mark_duplicated_binary_clauses_as_garbage ();
     probe_core ();
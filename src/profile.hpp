@@ -37,6 +37,7 @@ class Internal;
 #define PROFILES \
 PROFILE(analyze,3) \
 PROFILE(bump,4) \
+PROFILE(bva,2) \
 PROFILE(collect,2) \
 PROFILE(compact,2) \
 PROFILE(connect,2) \
@@ -44,6 +45,7 @@ PROFILE(decide,3) \
 PROFILE(decompose,2) \
 PROFILE(elim,2) \
 PROFILE(extend,4) \
+PROFILE(gauss,2) \
 PROFILE(minimize,4) \
 PROFILE(parse,1) \
 PROFILE(probe,2) \
@@ -51,11 +53,14 @@ PROFILE(deduplicate,2) \
 PROFILE(propagate,4) \
 PROFILE(reduce,2) \
 PROFILE(restart,3) \
+PROFILE(restore,2) \
+PROFILE(shrink,4) \
 PROFILE(search,1) \
 PROFILE(simplify,1) \
 PROFILE(subsume,2) \
 PROFILE(transred,2) \
 PROFILE(vivify,2) \
+PROFILE(walk,2) \
 
 /*------------------------------------------------------------------------*/
 
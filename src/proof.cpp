@@ -26,7 +26,7 @@ void Internal::close_proof () {
 
 Proof::Proof (Internal * s, File * f, bool b, bool o)
 :
-  internal (s), file (f), binary (b), owned (o)
+  internal (s), file (f), binary (b), owned (o), max_var (0), min_var (0)
 {
 }
 
@@ -34,6 +34,31 @@ Proof::~Proof () { if (owned) delete file; }
 
 /*------------------------------------------------------------------------*/
 
+// Internal variables without external counter part, e.g., activation
+// literals or variables introduced by bounded variable addition, get fresh
+// proof variable indices on first use, which are larger than all external
+// variables so far.  If external variables are added later, those proof
+// variables which would clash with them are renamed by 'relocate'.
+
+int Proof::externalize (int lit) {
+  int res = internal->externalize (lit);
+  if (res) return res;
+  const int idx = abs (lit);
+  int & pidx = internal->i2p[idx];
+  if (!pidx) {
+    const int external_max_var = internal->external->max_var;
+    if (max_var < external_max_var) max_var = external_max_var;
+    pidx = ++max_var;
+    if (!min_var) min_var = pidx;
+    LOG ("internal variable %d traced as proof variable %d", idx, pidx);
+  }
+  res = pidx;
+  if (lit < 0) res = -res;
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 // Support for binary DRAT format.
 
 inline void Proof::put_binary_zero () {
@@ -112,6 +137,32 @@ void Proof::trace_add_clause () {
   else file->put ("0\n");
 }
 
+// Binary clauses and units (if 'b' is zero) given as proof literals.
+
+void Proof::trace_clause (int a, int b, bool add) {
+  if (binary) {
+    file->put (add ? 'a' : 'd');
+    put_binary_lit (a);
+    if (b) put_binary_lit (b);
+    put_binary_zero ();
+  } else {
+    if (!add) file->put ("d ");
+    file->put (a), file->put (" ");
+    if (b) file->put (b), file->put (" ");
+    file->put ("0\n");
+  }
+}
+
+// Root level units of internal variables without external counter part are
+// deleted if these variables are removed by 'compact', since nothing refers
+// to their proof variables anymore, which thus can be used by external
+// variables added later.
+
+void Proof::trace_delete_unit_clause (int unit) {
+  LOG ("tracing deletion of unit clause %d", unit);
+  trace_clause (externalize (unit), 0, false);
+}
+
 /*------------------------------------------------------------------------*/
 
 // During garbage collection clauses are shrunken by removing falsified
@@ -156,4 +207,80 @@ void Proof::trace_strengthen_clause (Clause * c, int remove) {
   trace_clause (c, false);
 }
 
+/*------------------------------------------------------------------------*/
+
+// If new external variables clash with proof variables of internal
+// variables, the latter are renamed to proof variables which are larger
+// than twice the new maximum external variable.  Thus adding external
+// variables one by one renames every such variable only a logarithmic
+// number of times.  An old proof variable 'x' is renamed to the fresh 'y'
+// by first adding the definition '-y x', which is RAT on '-y', and 'y -x',
+// which is RAT on 'y'.  Then every clause with 'x' is copied with 'y'
+// instead of 'x' and deleted, which includes the unit if 'x' is fixed.
+// Finally the definition is deleted and 'x' does not occur anymore.
+
+void Proof::relocate (int new_max_var) {
+
+  if (!min_var || new_max_var < min_var) return;
+
+  const int limit = new_max_var < INT_MAX/2 ? 2*new_max_var : new_max_var;
+  if (max_var < limit) max_var = limit;
+  min_var = 0;
+
+  vector<int> renamed, fresh (internal->max_var + 1, 0);
+  for (int idx = 1; idx <= internal->max_var; idx++) {
+    if (internal->i2e[idx]) continue;
+    const int pidx = internal->i2p[idx];
+    if (!pidx) continue;
+    if (pidx <= new_max_var) {
+      const int tmp = fresh[idx] = ++max_var;
+      LOG ("renaming proof variable %d of internal variable %d to %d",
+        pidx, idx, tmp);
+      trace_clause (-tmp, pidx, true);
+      trace_clause (tmp, -pidx, true);
+      renamed.push_back (idx);
+      if (!min_var || tmp < min_var) min_var = tmp;
+    } else if (!min_var || pidx < min_var) min_var = pidx;
+  }
+  if (renamed.empty ()) return;
+
+  // The proof variables of renamed variables in a clause are swapped with
+  // their fresh ones for tracing the copy and swapped back for deleting.
+
+  int * i2p = internal->i2p;
+  const const_clause_iterator end = internal->clauses.end ();
+  for (const_clause_iterator i = internal->clauses.begin (); i != end; i++) {
+    Clause * c = *i;
+    if (c->garbage) continue;
+    const const_literal_iterator eoc = c->end ();
+    const_literal_iterator j;
+    for (j = c->begin (); j != eoc; j++)
+      if (fresh[abs (*j)]) break;
+    if (j == eoc) continue;
+    for (j = c->begin (); j != eoc; j++) {
+      const int idx = abs (*j);
+      if (fresh[idx]) swap (i2p[idx], fresh[idx]);
+    }
+    trace_clause (c, true);
+    for (j = c->begin (); j != eoc; j++) {
+      const int idx = abs (*j);
+      if (fresh[idx]) swap (i2p[idx], fresh[idx]);
+    }
+    trace_clause (c, false);
+  }
+
+  const const_int_iterator eor = renamed.end ();
+  for (const_int_iterator i = renamed.begin (); i != eor; i++) {
+    const int idx = *i, old = i2p[idx], pidx = fresh[idx];
+    const int tmp = internal->fixed (idx);
+    if (tmp) {
+      trace_clause (tmp < 0 ? -pidx : pidx, 0, true);
+      trace_clause (tmp < 0 ? -old : old, 0, false);
+    }
+    trace_clause (-pidx, old, false);
+    trace_clause (pidx, -old, false);
+    i2p[idx] = pidx;
+  }
+}
+
 };
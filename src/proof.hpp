@@ -17,10 +17,14 @@ class Proof {
   bool binary;
   bool owned;
 
+  int max_var;          // maximum variable index used in the proof
+  int min_var;          // minimum proof index of internal variables
+
   void put_binary_zero ();
   void put_binary_lit (int lit);
 
   void trace_clause (Clause *, bool add);
+  void trace_clause (int a, int b, bool add);
 
   int externalize (int lit);
 
@@ -36,6 +40,9 @@ public:
   void trace_delete_clause (Clause *);
   void trace_flushing_clause (Clause *);
   void trace_strengthen_clause (Clause *, int);
+  void trace_delete_unit_clause (int unit);
+
+  void relocate (int new_max_var);
 };
 
 };
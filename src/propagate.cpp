@@ -71,6 +71,73 @@ void Internal::assign_driving (int lit, Clause * c) {
 
 /*------------------------------------------------------------------------*/
 
+// Counting propagation of cardinality constraints (see 'atmost.cpp').  All
+// constraints of an assigned literal are counted even after a conflict was
+// found, since 'backtrack' expects all counts to include all literals on
+// the trail before 'atmost_propagated'.
+
+void Internal::propagate_atmosts () {
+  assert (atab);
+  while (!conflict && atmost_propagated < trail.size ()) {
+    const int lit = trail[atmost_propagated++];
+    const Atmosts & as = atmosts (lit);
+    const const_atmost_iterator end = as.end ();
+    const_atmost_iterator i;
+    for (i = as.begin (); i != end; i++) {
+      Atmost * a = *i;
+      if (++a->count < a->bound) continue;
+      if (conflict) continue;
+      if (a->count > a->bound) { atmost_conflict (a); continue; }
+      const const_int_iterator eol = a->lits.end ();
+      const_int_iterator j;
+      for (j = a->lits.begin (); j != eol; j++) {
+        const int other = *j;
+        if (val (other)) continue;
+        stats.atmost.assigned++;
+        search_assign (-other, &atmost_reason);
+      }
+    }
+  }
+}
+
+// Parity constraints are propagated in the same way (see 'xor.cpp').
+// Redundant ones derived by Gaussian elimination are ignored during
+// vivification, which only watches irredundant clauses, since otherwise
+// irredundant clauses they were derived from could be removed.
+
+void Internal::propagate_xors () {
+  assert (xtab);
+  while (!conflict && xor_propagated < trail.size ()) {
+    const int lit = trail[xor_propagated++];
+    const Xors & xs = xoccs (lit);
+    const const_xor_iterator end = xs.end ();
+    const_xor_iterator i;
+    for (i = xs.begin (); i != end; i++) {
+      Xor * x = *i;
+      if (lit > 0) x->sum = !x->sum;
+      const int size = (int) x->vars.size ();
+      if (++x->count < size - 1) continue;
+      if (conflict) continue;
+      if (vivifying && x->redundant) continue;
+      if (x->count == size) {
+        if (x->sum != x->parity) xor_conflict (x);
+        continue;
+      }
+      const const_int_iterator eol = x->vars.end ();
+      const_int_iterator j;
+      for (j = x->vars.begin (); j != eol; j++) {
+        const int other = *j;
+        if (val (other)) continue;
+        stats.xors.assigned++;
+        search_assign (x->sum == x->parity ? -other : other, &xor_reason);
+        break;
+      }
+    }
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 // The 'propagate' function is usually the hot-spot of a CDCL SAT solver.
 // The 'trail' stack saves assigned variables and is used here as BFS queue
 // for checking clauses with the negation of assigned variables for being in
@@ -96,15 +163,31 @@ bool Internal::propagate () {
   START (propagate);
 
   // Updating the statistics counter in the propagation loops is costly so
-  // we delay until propagation ran to completion.
+  // we delay until propagation ran to completion.  The same applies to the
+  // 'ticks', which count one for each traversed watch list plus its cache
+  // lines and one for each visited long clause.  These measure the actual
+  // memory access effort and bound inprocessing (see 'probe' etc.).
   //
-  long before = propagated;
+  long before = propagated, ticks = 0;
 
-  while (!conflict && propagated < trail.size ()) {
+  while (!conflict) {
+
+    // Cardinality and parity constraints are only propagated after all
+    // clauses and then clauses again if they assigned new literals (and
+    // never during inprocessing, see 'atmost.cpp' and 'xor.cpp').
+
+    if (propagated == trail.size ()) {
+      if (simplifying) break;
+      if (atab && atmost_propagated < trail.size ()) propagate_atmosts ();
+      else if (xtab && xor_propagated < trail.size ()) propagate_xors ();
+      else break;
+      continue;
+    }
 
     const int lit = -trail[propagated++];
     LOG ("propagating %d", -lit);
     Watches & ws = watches (lit);
+    ticks += 1 + cache_lines (ws.size (), sizeof (Watch));
 
     const_watch_iterator i = ws.begin ();
     watch_iterator j = ws.begin ();
@@ -140,6 +223,7 @@ bool Internal::propagate () {
         // having this enabled all the time).
 
         EXPENSIVE_STATS_ADD (visits, 1);
+        ticks++;
 
 	// The cache line with the clause data is forced to be loaded here
 	// and thus this first memory access below is the real hot-spot of
@@ -268,8 +352,13 @@ bool Internal::propagate () {
     }
   }
   long delta = propagated - before;
-  if (vivifying) stats.propagations.vivify += delta;
-  else stats.propagations.search += delta;
+  if (vivifying) {
+    stats.propagations.vivify += delta;
+    stats.ticks.vivify += ticks;
+  } else {
+    stats.propagations.search += delta;
+    stats.ticks.search += ticks;
+  }
   if (conflict) {
     if (!vivifying) stats.conflicts++;
     LOG (conflict, "conflict");
@@ -0,0 +1,53 @@
+#ifndef _radix_hpp_INCLUDED
+#define _radix_hpp_INCLUDED
+
+#include <iterator>
+#include <vector>
+
+namespace CaDiCaL {
+
+// Stable least significant digit first radix sort on unsigned ranks with
+// eight bit digits.  Digits on which all ranks agree are skipped, which for
+// instance for trail positions of learned clause literals usually leaves
+// only one or two rounds.  The 'RANK' functor maps elements to ranks.
+
+template<class I, class RANK> void rsort (I begin, I end, RANK rank) {
+
+  typedef typename std::iterator_traits<I>::value_type T;
+
+  const size_t n = end - begin;
+  if (n < 2) return;
+
+  unsigned lower = ~0u, upper = 0;
+  for (I i = begin; i != end; i++) {
+    const unsigned r = rank (*i);
+    lower &= r, upper |= r;
+  }
+
+  std::vector<T> tmp (n);
+  T * a = &*begin, * b = &tmp[0];
+  size_t count[256];
+
+  for (unsigned shift = 0; shift < 32; shift += 8) {
+    const unsigned mask = 255u << shift;
+    if ((lower & mask) == (upper & mask)) continue;   // same digit
+    for (size_t c = 0; c < 256; c++) count[c] = 0;
+    for (size_t i = 0; i < n; i++) count[(rank (a[i]) >> shift) & 255]++;
+    size_t pos = 0;
+    for (size_t c = 0; c < 256; c++) {
+      const size_t k = count[c];
+      count[c] = pos;
+      pos += k;
+    }
+    for (size_t i = 0; i < n; i++)
+      b[count[(rank (a[i]) >> shift) & 255]++] = a[i];
+    T * t = a; a = b; b = t;
+  }
+
+  if (a != &*begin)
+    for (size_t i = 0; i < n; i++) begin[i] = a[i];
+}
+
+};
+
+#endif
@@ -15,11 +15,15 @@ bool Internal::reducing () {
 
 // Reason clauses (on non-zero decision level) can not be collected.
 // We protect them before and unprotect them after garbage collection.
+// Literals assigned by cardinality or parity constraints, which have not
+// been explained yet, do not have a reason clause (see 'atmost.cpp').
 
 void Internal::protect_reasons () {
   for (const_int_iterator i = trail.begin (); i != trail.end (); i++) {
     Var & v = var (*i);
     if (!v.level || !v.reason) continue;
+    if (v.reason == &atmost_reason) continue;
+    if (v.reason == &xor_reason) continue;
     v.reason->reason = true;
   }
 }
@@ -28,6 +32,8 @@ void Internal::unprotect_reasons () {
   for (const_int_iterator i = trail.begin (); i != trail.end (); i++) {
     Var & v = var (*i);
     if (!v.level || !v.reason) continue;
+    if (v.reason == &atmost_reason) continue;
+    if (v.reason == &xor_reason) continue;
     assert (v.reason->reason), v.reason->reason = false;
   }
 }
@@ -69,11 +75,19 @@ void Internal::update_clause_useful_probability (Clause * c, bool used) {
 
 // This function implements the important reduction policy. It determines
 // which redundant clauses are considered not useful and thus will be
-// collected in a subsequent garbage collection phase.
+// collected in a subsequent garbage collection phase.  Learned clauses are
+// partitioned into three tiers by their glue, which is updated when they
+// are used in conflict analysis (see 'bump_clause').  Core clauses with
+// glue at most 'keepglue' (as well as small clauses) are kept.  Tier-two
+// clauses with glue at most 'reducetier2' are kept as long as they have
+// been used within the last two reduce intervals.  The remaining local
+// clauses are only kept if used since the last 'reduce'.  Clauses not kept
+// this way are sorted by usefulness and the less useful half is collected.
 
 void Internal::mark_useless_redundant_clauses_as_garbage () {
   vector<Clause*> stack;
   stack.reserve (stats.redundant);
+  long tier2 = 0, local = 0;
   const_clause_iterator end = clauses.end (), i;
   for (i = clauses.begin (); i != end; i++) {
     Clause * c = *i;
@@ -87,15 +101,25 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
       if (!used) mark_garbage (c);		// keep it for one round
       continue;
     }
-    if (c->keep) continue;             		// statically considered useful
+    if (c->keep) continue;             		// core clause
     update_clause_useful_probability (c, used);
-    if (used) continue;				// keep recently used
+    if (c->glue <= opts.reducetier2) {
+      assert (c->extended);
+      const unsigned age = (unsigned) stats.conflicts - c->used_at;
+      if (age < (unsigned) 2*inc.reduce) {	// tier-two used recently
+	tier2++;
+	continue;
+      }
+    } else if (used) { local++; continue; }	// local used since last
     stack.push_back (c);
   }
 
   VRB ("reduce", stats.reductions,
-    "useful:  %f / glue + %f / size",
-    stats.reductions, wg, ws);
+    "useful:  %f / glue + %f / size", wg, ws);
+
+  VRB ("reduce", stats.reductions,
+    "kept %ld tier-two and %ld local clauses, %ld candidates",
+    tier2, local, (long) stack.size ());
 
   stable_sort (stack.begin (), stack.end (), less_usefull (this));
 
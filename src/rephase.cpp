@@ -2,22 +2,57 @@
 
 namespace CaDiCaL {
 
+// Rephasing resets the saved phases.  The schedule cycles through the
+// phases found by local search (see 'walk.cpp'), the best phases (see
+// 'update_target_and_best'), the original phase (as given by the 'phase'
+// option) and again walk and best phases, followed by the inverted original
+// phase.  Target phases are reset to the new saved phases, while the best
+// phases are kept, such that they always are the phases of the largest
+// conflict free trail so far (only 'compact' starts them over, since it
+// removes the root level assigned variables from the trail).  The rephase
+// interval grows arithmetically.
+
 bool Internal::rephasing () {
   if (!opts.rephase) return false;
   return stats.conflicts > lim.rephase;
 }
 
 void Internal::rephase () {
-  stats.rephased++;
-  LOG ("rephase %ld", stats.rephased);
-  signed char val = opts.phase ? 1 : -1;
-  if (stats.rephased & 1) val = -val;
-  for (int idx = 1; idx <= max_var; idx++) phases[idx] = val;
+  stats.rephased.total++;
+  LOG ("rephase %ld", stats.rephased.total);
   backtrack ();
-  inc.rephase *= 2;
+  signed char val = opts.phase ? 1 : -1;
+  char type;
+  switch (stats.rephased.total % 6) {
+    case 1:
+    case 4:
+      type = 'W';
+      stats.rephased.walk++;
+      walk ();
+      break;
+    case 3:
+      type = 'O';
+      stats.rephased.original++;
+      for (int idx = 1; idx <= max_var; idx++) phases[idx] = val;
+      break;
+    case 0:
+      type = 'I';
+      stats.rephased.inverted++;
+      for (int idx = 1; idx <= max_var; idx++) phases[idx] = -val;
+      break;
+    default:
+      type = 'B';
+      stats.rephased.best++;
+      for (int idx = 1; idx <= max_var; idx++)
+        if (best_phases[idx]) phases[idx] = best_phases[idx];
+      break;
+  }
+  for (int idx = 1; idx <= max_var; idx++) target_phases[idx] = phases[idx];
+  target_assigned = 0;
+  inc.rephase += opts.rephaseint;
   lim.rephase = stats.conflicts + inc.rephase;
   LOG ("next rephase after %ld conflicts", lim.rephase);
-  report ('~');
+  report (type);
 }
 
 };
@@ -7,12 +7,14 @@ namespace CaDiCaL {
 // moving average of the average recent glue level of learned clauses as
 // well as fast moving average of those glues.  If the end of base restart
 // conflict interval has passed and the fast moving average is above a
-// certain margin of the slow moving average then we restart.
+// certain margin of the slow moving average then we restart.  In stable
+// mode (see 'mode.cpp') we simply restart when the conflict limit is hit.
 
 bool Internal::restarting () {
   if (!opts.restart) return false;
   if (stats.conflicts <= lim.restart) return false;
-  if (level < 2) return false;
+  if (level < (int) assumptions.size () + 2) return false;
+  if (stable) return true;
   if (level < fast_glue_avg) return false;
   double s = slow_glue_avg, f = fast_glue_avg, l = opts.restartmargin * s;
   LOG ("EMA glue slow %.2f fast %.2f limit %.2f", s, f, l);
@@ -22,15 +24,38 @@ bool Internal::restarting () {
 // This is Marijn's reuse trail idea.  Instead of always backtracking to the
 // top we figure out which decisions would be made again anyhow and only
 // backtrack to the level of the last such decision or if no such decision
-// exists to the top (in which case we do reuse any level).
+// exists to the top (in which case we do reuse any level).  The levels of
+// assumptions are always kept, since they would be decided again anyhow.
 
 int Internal::reuse_trail () {
-  if (!opts.reusetrail) return 0;
-  long limit = bumped (next_decision_variable ());
-  int res = 0;
-  while (res < level && bumped (control[res + 1].decision) > limit)
-    res++;
-  if (res) stats.reused++;
+  const int assumed = min (level, (int) assumptions.size ());
+  if (!opts.reusetrail || assumed == level) return assumed;
+  const int next = next_decision_variable ();
+  int res = assumed;
+  if (scoring) {
+    const double limit = score (next);
+    while (res < level && score (control[res + 1].decision) > limit)
+      res++;
+  } else {
+    const long limit = bumped (next);
+    while (res < level && bumped (control[res + 1].decision) > limit)
+      res++;
+  }
+  if (res > assumed) stats.reused++;
+  return res;
+}
+
+// The restart intervals in stable mode follow the reluctant doubling
+// sequence '1, 1, 2, 1, 1, 2, 4, 1, ...' of Knuth (which is the same as the
+// Luby sequence) multiplied by 'reluctant' conflicts.  The sequence is
+// started over as soon the interval would exceed 'reluctantmax'.
+
+long Internal::next_reluctant () {
+  long & u = inc.reluctant.u, & v = inc.reluctant.v;
+  const long res = v;
+  if ((u & -u) == v) u++, v = 1;
+  else v *= 2;
+  if (opts.reluctant * v > opts.reluctantmax) u = v = 1;
   return res;
 }
 
@@ -39,7 +64,11 @@ void Internal::restart () {
   stats.restarts++;
   LOG ("restart %ld", stats.restarts);
   backtrack (reuse_trail ());
-  lim.restart = stats.conflicts + opts.restartint;
+  target_assigned = 0;
+  if (stable) {
+    stats.stable.restarts++;
+    lim.restart = stats.conflicts + opts.reluctant * next_reluctant ();
+  } else lim.restart = stats.conflicts + opts.restartint;
   report ('R', 2);
   STOP (restart);
 }
@@ -0,0 +1,155 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Incremental solving might add clauses or assumptions with variables
+// which have been eliminated or substituted during earlier calls to
+// 'solve'.  Instead of forbidding this we restore the irredundant clauses
+// of such a variable which were saved on the extension stack.  Since these
+// clauses might contain other removed variables those have to be restored
+// too (recursively).  Clauses on the extension stack of variables which
+// stay removed can stay there, even if they contain restored variables.
+// Restored clauses are added again as original clauses.  Note that this
+// requires that 'elim' saves the clauses of both phases of the pivot.
+
+bool External::eliminated (int eidx) {
+  assert (0 < eidx), assert (eidx <= max_var);
+  const int ilit = e2i[eidx];
+  if (!ilit) return true;                         // removed by 'compact'
+  const Flags & f = internal->flags (ilit);
+  return f.eliminated () || f.substituted ();
+}
+
+// The clauses on the extension stack are stored as a zero followed by the
+// witness literal and then the rest of the clause.  Units pushed in 'elim'
+// after the eliminated clauses only give a default value to the witness
+// and are not restored.
+
+void External::restore_clauses (int eidx) {
+
+  START (restore);
+  LOG ("restoring clauses of removed external variable %d", eidx);
+  internal->stats.restorations++;
+
+  if (internal->level) internal->backtrack ();
+
+  vector<bool> tainted (max_var + 1, false);
+  tainted[eidx] = true;
+
+  const size_t size = extension.size ();
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    size_t i = 0;
+    while (i < size) {
+      assert (!extension[i]);
+      const int witness = abs (extension[i + 1]);
+      size_t j = i + 1;
+      while (j < size && extension[j]) {
+        const int idx = abs (extension[j++]);
+        if (!tainted[witness] || tainted[idx]) continue;
+        if (!eliminated (idx)) continue;
+        LOG ("restoring removed external variable %d too", idx);
+        tainted[idx] = changed = true;
+      }
+      i = j;
+    }
+  }
+
+  for (int idx = 1; idx <= max_var; idx++) {
+    if (!tainted[idx]) continue;
+    internal->stats.reactivated++;
+    int ilit = e2i[idx];
+    if (ilit) internal->reactivate (ilit);
+    else {
+      ilit = internal->max_var + 1;
+      internal->init (ilit);
+      LOG ("mapping restored external %d to new internal %d", idx, ilit);
+      e2i[idx] = ilit, internal->i2e[ilit] = idx;
+    }
+  }
+
+  // Save a partially added clause, since 'add' might have triggered this.
+
+  vector<int> saved;
+  swap (saved, internal->clause);
+
+  // Restored clauses are traced as added clauses with the witness first.
+  // Each of them is RAT on its witness if the clauses of variables removed
+  // later are restored first, while for the same witness variable the
+  // saved order is kept (clauses with the pivot before those with its
+  // negation).  Thus consecutive clauses of the same witness variable are
+  // restored as one block and the blocks are restored in reverse order.
+
+  vector<size_t> blocks;
+  size_t i = 0, j = 0, restored = 0;
+  int last = 0;
+  while (i < size) {
+    assert (!extension[i]);
+    size_t end = i + 1;
+    while (end < size && extension[end]) end++;
+    const int witness = abs (extension[i + 1]);
+    if (tainted[witness] && end - i > 2) {
+      if (witness != last) blocks.push_back (i);
+      last = witness;
+    } else last = 0;
+    i = end;
+  }
+
+  size_t block = blocks.size ();
+  while (block-- > 0) {
+    i = blocks[block];
+    const int witness = abs (extension[i + 1]);
+    while (i < size && abs (extension[i + 1]) == witness) {
+      size_t end = i + 1;
+      while (end < size && extension[end]) end++;
+      if (end - i <= 2) break;
+      for (size_t k = i + 1; k < end; k++) {
+        const int elit = extension[k], idx = abs (elit);
+        assert (!eliminated (idx));
+        const int ilit = elit < 0 ? -e2i[idx] : e2i[idx];
+        internal->add_original_lit (ilit);
+      }
+      if (internal->proof) internal->proof->trace_add_clause ();
+      internal->add_original_lit (0);
+      restored++;
+      i = end;
+    }
+  }
+
+  i = 0;
+  while (i < size) {
+    size_t end = i + 1;
+    while (end < size && extension[end]) end++;
+    const int witness = abs (extension[i + 1]);
+    if (tainted[witness]) i = end;
+    else while (i < end) extension[j++] = extension[i++];
+  }
+  extension.resize (j);
+
+  swap (saved, internal->clause);
+
+  VRB ("restore", internal->stats.restorations,
+    "restored %ld clauses for external variable %d", (long) restored, eidx);
+
+  STOP (restore);
+}
+
+// Called for restored variables which still have an internal variable.
+
+void Internal::reactivate (int lit) {
+  Flags & f = flags (lit);
+  assert (f.eliminated () || f.substituted ());
+  if (f.eliminated ()) {
+    assert (stats.now.eliminated > 0);
+    stats.now.eliminated--;
+  } else {
+    assert (stats.now.substituted > 0);
+    stats.now.substituted--;
+  }
+  LOG ("reactivating %d", abs (lit));
+  f.status = Flags::ACTIVE;
+  f.added = f.removed = true;
+}
+
+};
@@ -0,0 +1,75 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Exponential VSIDS (EVSIDS) as in MiniSAT is an alternative to the VMTF
+// queue for picking decisions, selected with '--vsids'.  Variables analyzed
+// in a conflict get their score increased by 'score_inc', which in turn is
+// increased by the factor '1/vsidsdecay' after each conflict.  Thus older
+// bumps decay exponentially.  Scores are rescaled before they overflow.
+// Unassigned variables are kept in the binary heap 'scores' ordered by
+// score.  Assigned variables are only removed lazily when they show up at
+// the top in 'next_decision_variable' and are put back in 'search_unassign'.
+
+// While scores are used the VMTF queue is not updated, except for new
+// variables and during 'compact'.  The heap is only maintained while scores
+// are used and is rebuilt when switching to scores.  Switching back just
+// resets 'queue.unassigned' to the last variable in the queue.
+
+void Internal::rescale_scores () {
+  stats.rescored++;
+  const double factor = 1e-150;
+  for (int idx = 1; idx <= max_var; idx++) stab[idx] *= factor;
+  score_inc *= factor;
+  LOG ("rescaled scores by factor %g", factor);
+}
+
+void Internal::bump_score (int lit) {
+  const int idx = vidx (lit);
+  double & s = score (idx);
+  s += score_inc;
+  LOG ("bumped score of %d to %g", idx, s);
+  if (s > 1e150) rescale_scores ();
+  if (scores.contains (idx)) scores.update (idx);
+}
+
+// The order in which analyzed variables are bumped does not matter here.
+
+void Internal::bump_scores () {
+  START (bump);
+  for (const_int_iterator i = analyzed.begin (); i != analyzed.end (); i++)
+    if (!flags (*i).assumed) bump_score (*i);
+  score_inc /= opts.vsidsdecay;
+  if (score_inc > 1e150) rescale_scores ();
+  STOP (bump);
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::init_scores () {
+  assert (scores.empty ());
+  for (int idx = 1; idx <= max_var; idx++)
+    if (!val (idx)) scores.push_back (idx);
+  LOG ("initialized heap with %ld unassigned variables",
+    (long) scores.size ());
+}
+
+// Called at the start of 'solve', such that the option can be changed
+// between incremental calls, and when switching modes (see 'mode.cpp').
+// Scores are always used in stable mode.
+
+void Internal::update_decision_heuristic () {
+  const bool wanted = opts.vsids || stable;
+  if (scoring == wanted) return;
+  scoring = wanted;
+  if (scoring) {
+    VRB ("decide", "switching to EVSIDS scores for decisions");
+    init_scores ();
+  } else {
+    VRB ("decide", "switching to VMTF queue for decisions");
+    scores.erase ();
+    update_queue_unassigned (queue.last);
+  }
+}
+
+};
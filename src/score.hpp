@@ -0,0 +1,20 @@
+#ifndef _score_hpp_INCLUDED
+#define _score_hpp_INCLUDED
+
+#include "heap.hpp"
+
+namespace CaDiCaL {
+
+class Internal;
+
+struct score_smaller {
+  Internal * internal;
+  score_smaller (Internal * i) : internal (i) { }
+  bool operator () (int a, int b);
+};
+
+typedef heap<score_smaller> ScoreSchedule;
+
+};
+
+#endif
@@ -0,0 +1,348 @@
+#include "cadical.hpp"
+#include "server.hpp"
+#include "signal.hpp"
+
+/*------------------------------------------------------------------------*/
+
+#include <cassert>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/*------------------------------------------------------------------------*/
+
+extern "C" {
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+};
+
+/*------------------------------------------------------------------------*/
+
+// Each request is a single line and the response consists of zero or more
+// lines followed by a single line starting with either 'ok' or 'error'.
+// Comment lines starting with 'c' might occur in responses too (for
+// instance if messages are enabled with 'set --no-quiet').
+//
+//   add <lit> ... 0             add a clause
+//   assume <lit> ... 0          assume literals for the next 'solve'
+//   load <path>                 read DIMACS file (iCNF queries are solved)
+//   solve [ <limit>=<n> ... ]   solve and print 's ...' status line
+//   model                       print 'v <lit> ... 0' line after 'SAT'
+//   stats                       print statistics
+//   set --<name>=<val>          set option of session solver
+//   reset                       start again with a fresh solver
+//   quit                        close session
+//
+// Supported per request limits of 'solve' are 'conflicts', 'decisions',
+// 'propagations' and 'time' (in seconds).  They only apply to this single
+// 'solve' call.  A limited 'solve' continues the search of a previous
+// limited 'solve', which ran out of its limits, if nothing changed since.
+
+/*------------------------------------------------------------------------*/
+
+namespace CaDiCaL {
+
+using namespace std;
+
+Solver * Server::solver;
+const char * Server::path;
+int Server::result;
+volatile sig_atomic_t Server::stopping;
+volatile sig_atomic_t Server::alarmed;
+vector<const char *> Server::options;
+
+/*------------------------------------------------------------------------*/
+
+// The 'time' limit of 'solve' is implemented with 'alarm'.  The signal
+// handler only sets a flag, which is polled by the solver through this
+// terminator, since calling into the solver from a handler is not safe.
+
+class Alarm : public Terminator {
+public:
+  bool terminate () { return Server::alarmed; }
+};
+
+static Alarm alarm_terminator;
+
+// The options given on the command line are set for each new solver after
+// making it quiet.  Messages would go to the client otherwise.
+
+void Server::new_solver () {
+  if (solver) delete solver;
+  solver = new Solver ();
+  solver->connect_terminator (&alarm_terminator);
+  solver->set ("quiet", 1);
+  for (size_t i = 0; i < options.size (); i++)
+    solver->set (options[i]);
+  result = 0;
+}
+
+void Server::status (int res) {
+  if (res == 10) puts ("s SATISFIABLE");
+  else if (res == 20) puts ("s UNSATISFIABLE");
+  else puts ("s UNKNOWN");
+}
+
+void Server::model () {
+  fputc ('v', stdout);
+  for (int idx = 1; idx <= solver->max (); idx++)
+    printf (" %d", solver->val (idx) < 0 ? -idx : idx);
+  fputs (" 0\n", stdout);
+}
+
+void Server::statistics () {
+  const double quiet = solver->get ("quiet");
+  solver->set ("quiet", 0);
+  solver->statistics ();
+  solver->set ("quiet", quiet);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Parse zero terminated list of literals, which has to end the line.
+
+static bool parse_lits (const char * p, vector<int> & lits) {
+  for (;;) {
+    while (isspace (*p)) p++;
+    if (!*p) return false;
+    char * end;
+    errno = 0;
+    long lit = strtol (p, &end, 10);
+    if (end == p || errno) return false;
+    if (*end && !isspace (*end)) return false;
+    if (lit <= INT_MIN || lit > INT_MAX) return false;
+    lits.push_back (lit);
+    p = end;
+    if (!lit) break;
+  }
+  while (isspace (*p)) p++;
+  return !*p;
+}
+
+// Incremental CNF files are solved query by query as in 'App'.
+
+const char * Server::load (const char * p) {
+  const char * err = solver->dimacs (p);
+  if (err) return err;
+  result = 0;
+  long queries = 0;
+  while (solver->incremental ()) {
+    bool assumed;
+    if ((err = solver->query (assumed))) return err;
+    if (!assumed) break;
+    result = solver->solve ();
+    printf ("c query %ld\n", ++queries);
+    status (result);
+  }
+  return 0;
+}
+
+const char * Server::solve (char * limits) {
+  Budget budget;
+  long seconds = 0;
+  bool limited = false;
+  for (char * l = strtok (limits, " \t"); l; l = strtok (0, " \t")) {
+    char * v = strchr (l, '=');
+    if (!v) return "expected '<limit>=<n>'";
+    *v++ = 0;
+    char * end;
+    errno = 0;
+    long n = strtol (v, &end, 10);
+    if (end == v || *end || errno || n < 0 || n > 1e9)
+      return "invalid limit value";
+    if (!strcmp (l, "conflicts")) budget.conflicts = n;
+    else if (!strcmp (l, "decisions")) budget.decisions = n;
+    else if (!strcmp (l, "propagations")) budget.propagations = n;
+    else if (!strcmp (l, "time")) seconds = n;
+    else return "unknown limit";
+    limited = true;
+  }
+  alarmed = 0;
+  if (seconds) ::alarm (seconds);
+  result = limited ? solver->solve (budget) : solver->solve ();
+  if (seconds) ::alarm (0);
+  alarmed = 0;
+  status (result);
+  return 0;
+}
+
+// Returns 'false' if the session should be closed.
+
+bool Server::request (char * line) {
+  char * p = line;
+  while (isspace (*p)) p++;
+  if (!*p || *p == 'c') return true;
+  char * cmd = p;
+  while (*p && !isspace (*p)) p++;
+  if (*p) *p++ = 0;
+  while (isspace (*p)) p++;
+  char * end = p + strlen (p);
+  while (end > p && isspace (end[-1])) *--end = 0;
+  const char * err = 0;
+  if (!strcmp (cmd, "quit")) {
+    puts ("ok");
+    return false;
+  } else if (!strcmp (cmd, "add") || !strcmp (cmd, "assume")) {
+    vector<int> lits;
+    if (!parse_lits (p, lits)) err = "expected literals terminated by '0'";
+    else if (cmd[1] == 'd') {
+      for (size_t i = 0; i < lits.size (); i++) solver->add (lits[i]);
+      result = 0;
+    } else {
+      for (size_t i = 0; lits[i]; i++) solver->assume (lits[i]);
+    }
+  } else if (!strcmp (cmd, "load")) {
+    if (!*p) err = "missing path";
+    else err = load (p);
+  } else if (!strcmp (cmd, "solve")) err = solve (p);
+  else if (!strcmp (cmd, "model")) {
+    if (result != 10) err = "no model";
+    else model ();
+  } else if (!strcmp (cmd, "stats")) statistics ();
+  else if (!strcmp (cmd, "set")) {
+    if (!solver->set (p)) err = "invalid option";
+  } else if (!strcmp (cmd, "reset")) new_solver ();
+  else err = "unknown request";
+  if (err) printf ("error %s\n", err);
+  else puts ("ok");
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+// All output of the session solver goes to '<stdout>', which for the time
+// of the session is redirected to the client connection.
+
+void Server::session (int fd) {
+  FILE * in = fdopen (fd, "r");
+  if (!in) { close (fd); return; }
+  fflush (stdout);
+  const int saved = dup (1);
+  dup2 (fd, 1);
+  new_solver ();
+  char * line = 0;
+  size_t size = 0;
+  bool open = true;
+  while (open && getline (&line, &size, in) >= 0) {
+    open = request (line);
+    fflush (stdout);
+  }
+  free (line);
+  delete solver;
+  solver = 0;
+  fflush (stdout);
+  dup2 (saved, 1);
+  close (saved);
+  fclose (in);
+}
+
+void Server::catchalarm (int) { alarmed = 1; }
+
+// Workers die on 'SIGTERM' (default handler) and ignore broken pipes, e.g.,
+// if a client closes the connection while still receiving a response.
+
+void Server::worker (int sock) {
+  Signal::reset ();
+  (void) signal (SIGINT, SIG_DFL);
+  (void) signal (SIGTERM, SIG_DFL);
+  (void) signal (SIGPIPE, SIG_IGN);
+  (void) signal (SIGALRM, Server::catchalarm);
+  for (;;) {
+    int fd = accept (sock, 0, 0);
+    if (fd >= 0) session (fd);
+    else if (errno != EINTR) _exit (1);
+  }
+}
+
+int Server::spawn (int sock) {
+  int pid = fork ();
+  if (!pid) worker (sock), _exit (0);
+  return pid;
+}
+
+void Server::catchstop (int) { stopping = true; }
+
+/*------------------------------------------------------------------------*/
+
+const char * Server::serve (const char * p, int workers,
+                            const vector<const char *> & o) {
+  static char error[256];
+  struct sockaddr_un addr;
+  path = p, options = o;
+  if (strlen (path) >= sizeof addr.sun_path) {
+    snprintf (error, sizeof error, "socket path '%s' too long", path);
+    return error;
+  }
+  struct stat buf;
+  if (!stat (path, &buf)) {
+    if (!S_ISSOCK (buf.st_mode)) {
+      snprintf (error, sizeof error,
+        "'%s' exists and is not a socket", path);
+      return error;
+    }
+    unlink (path);                      // stale socket of previous server
+  }
+  int sock = socket (AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0) {
+    snprintf (error, sizeof error,
+      "can not create socket: %s", strerror (errno));
+    return error;
+  }
+  memset (&addr, 0, sizeof addr);
+  addr.sun_family = AF_UNIX;
+  strcpy (addr.sun_path, path);
+  if (bind (sock, (struct sockaddr *) &addr, sizeof addr) ||
+      listen (sock, SOMAXCONN)) {
+    snprintf (error, sizeof error,
+      "can not listen on '%s': %s", path, strerror (errno));
+    close (sock);
+    return error;
+  }
+
+  // Without 'SA_RESTART' so that 'wait' below is interrupted.
+  //
+  struct sigaction action;
+  memset (&action, 0, sizeof action);
+  action.sa_handler = Server::catchstop;
+  sigaction (SIGINT, &action, 0);
+  sigaction (SIGTERM, &action, 0);
+
+  vector<int> pids;
+  for (int i = 0; !stopping && i < workers; i++) {
+    int pid = spawn (sock);
+    if (pid < 0) {
+      snprintf (error, sizeof error,
+        "can not fork worker: %s", strerror (errno));
+      stopping = true;
+    } else pids.push_back (pid);
+  }
+
+  // Respawn workers which died unexpectedly until we are stopped.
+  //
+  while (!stopping) {
+    int pid = wait (0);
+    if (pid < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    for (size_t i = 0; !stopping && i < pids.size (); i++)
+      if (pids[i] == pid) pids[i] = spawn (sock);
+  }
+  for (size_t i = 0; i < pids.size (); i++)
+    if (pids[i] > 0) kill (pids[i], SIGTERM);
+  while (wait (0) > 0)
+    ;
+  close (sock);
+  unlink (path);
+  return *error ? error : 0;
+}
+
+};
@@ -0,0 +1,64 @@
+#ifndef _server_hpp_INCLUDED
+#define _server_hpp_INCLUDED
+
+#include <csignal>
+#include <vector>
+
+namespace CaDiCaL {
+
+// Long-lived solver server for 'App' enabled with '--serve <socket>'.
+//
+// It listens on a local UNIX domain socket and keeps a pool of pre-forked
+// worker processes.  Each worker serves one client session at a time, with
+// its own resident 'Solver', which thus keeps all its learned clauses
+// between requests of the same session.  Since sessions live in different
+// processes they are completely isolated from each other.  Similar to
+// 'Signal' this uses static data and is neither thread-safe nor reentrant.
+
+class Solver;
+
+class Server {
+
+  friend class Alarm;
+
+  static Solver * solver;       // solver of the current session
+  static const char * path;     // path of the socket
+  static int result;            // result of last 'solve' in session
+
+  // Only set by signal handlers and polled in the main loop of 'serve'
+  // respectively by the 'Alarm' terminator of the session solver.
+  //
+  static volatile sig_atomic_t stopping;   // 'SIGINT' or 'SIGTERM' caught
+  static volatile sig_atomic_t alarmed;    // 'SIGALRM' caught
+
+  static std::vector<const char *> options;
+
+  static void catchstop (int sig);
+  static void catchalarm (int sig);
+
+  static void new_solver ();
+  static void status (int res);
+  static void model ();
+  static void statistics ();
+
+  static const char * load (const char * path);
+  static const char * solve (char * limits);
+  static bool request (char * line);
+
+  static void session (int fd);
+  static void worker (int sock);
+  static int spawn (int sock);
+
+public:
+
+  // Serve until 'SIGINT' or 'SIGTERM' is received.  Returns zero if
+  // successful and otherwise an error message.  The given options are set
+  // in the solver of each new session.
+  //
+  static const char * serve (const char * path, int workers,
+                             const std::vector<const char *> & options);
+};
+
+};
+
+#endif
@@ -0,0 +1,124 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Shrinking learned clauses is a generalization of minimization.  The
+// (minimized) first UIP clause is split into blocks of literals assigned on
+// the same decision level.  For each block with at least two literals we
+// try to replace the whole block by a single literal, which is a unique
+// implication point (UIP) of the block on its decision level.  This is
+// similar to deriving the first UIP during conflict analysis, except that
+// literals on lower decision levels in reasons have to be in the clause
+// already or have to be removable by minimization ('minimize_literal').
+
+// The clause is sorted with respect to the trail order before (see the
+// radix sort in 'analyze'), such that blocks are consecutive and the
+// trail walk of a block starts at the trail position of its last literal.
+// Blocks are shrunken from the highest to the lowest level.  The removed
+// literals are only used as 'keep' literals for minimizing literals on the
+// same or higher levels, which thus have already been processed.
+
+void Internal::mark_shrinkable (int lit, int & open) {
+  Flags & f = flags (lit);
+  if (f.shrinkable) return;
+  f.shrinkable = true;
+  shrinkable.push_back (lit);
+  open++;
+}
+
+void Internal::reset_shrinkable () {
+  const_int_iterator i;
+  for (i = shrinkable.begin (); i != shrinkable.end (); i++)
+    flags (*i).shrinkable = false;
+  shrinkable.clear ();
+}
+
+// Walk the trail of the decision level 'blevel' backward, starting at the
+// last literal of the block and resolve away all but the last remaining
+// 'shrinkable' literal, which is then returned as the UIP of the block.
+// If a reason contains a literal on a lower level which is neither in the
+// clause nor removable, shrinking fails and zero is returned.
+
+int Internal::shrink_block (int_iterator begin, int_iterator end,
+                            int blevel) {
+  assert (shrinkable.empty ());
+  assert (end - begin > 1);
+  int open = 0;
+  for (const_int_iterator i = begin; i != end; i++)
+    mark_shrinkable (-*i, open);
+
+  int pos = var (end[-1]).trail, uip;
+  for (;;) {
+    assert (pos >= control[blevel].trail);
+    while (!flags (uip = trail[pos--]).shrinkable)
+      assert (pos >= control[blevel].trail);
+    if (!--open) break;
+    Var & v = var (uip);
+    assert (v.level == blevel);
+    if (!v.reason) { uip = 0; break; }
+    if (v.reason == &atmost_reason) explain_atmost (uip);
+    else if (v.reason == &xor_reason) explain_xor (uip);
+    assert (v.reason);
+    const const_literal_iterator eor = v.reason->end ();
+    const_literal_iterator j;
+    for (j = v.reason->begin (); j != eor; j++) {
+      const int other = *j;
+      if (other == uip) continue;
+      const Var & w = var (other);
+      if (!w.level) continue;
+      assert (w.level <= blevel);
+      if (w.level == blevel) mark_shrinkable (-other, open);
+      else if (opts.minimize) {
+        if (!minimize_literal (-other)) break;
+      } else if (!flags (other).keep) break;
+    }
+    if (j != eor) { uip = 0; break; }
+  }
+  reset_shrinkable ();
+  return uip;
+}
+
+void Internal::shrink_clause () {
+  START (shrink);
+  LOG (clause, "shrinking first UIP clause");
+
+  const_int_iterator i;
+  for (i = clause.begin (); i != clause.end (); i++)
+    flags (*i).keep = true;
+
+  int_iterator end = clause.end ();
+  while (end != clause.begin ()) {
+    const int blevel = var (end[-1]).level;
+    int_iterator begin = end - 1;
+    while (begin != clause.begin () && var (begin[-1]).level == blevel)
+      begin--;
+    if (end - begin > 1) {
+      assert (blevel < level);
+      const int uip = shrink_block (begin, end, blevel);
+      if (uip) {
+        LOG ("shrunken %ld literals on level %d to %d",
+          (long)(end - begin), blevel, -uip);
+        stats.shrunken += (end - begin) - 1;
+        stats.shrunk++;
+        for (int_iterator k = begin; k != end; k++)
+          flags (*k).keep = false, *k = 0;
+        *begin = -uip;
+        Flags & f = flags (uip);
+        f.keep = true;
+        if (!f.seen) f.seen = true, analyzed.push_back (-uip);
+      }
+    }
+    end = begin;
+  }
+
+  int_iterator j = clause.begin ();
+  for (i = j; i != clause.end (); i++)
+    if (*i) *j++ = *i;
+  LOG ("shrunken %ld literals", (long)(clause.end () - j));
+  clause.resize (j - clause.begin ());
+  clear_minimized ();
+  external->check_learned_clause ();
+  STOP (shrink);
+}
+
+};
@@ -9,13 +9,19 @@ namespace CaDiCaL {
 // forward proof checking.  The incorrectly derived clause will raise an abort
 // signal and thus allows to debug the issue with a symbolic debugger immediately.
 
+// Literals of internal variables without external counter part, e.g.,
+// introduced by bounded variable addition, are not determined by the
+// solution and thus such clauses are considered to be satisfied.
+
 void External::check_solution_on_learned_clause () {
   assert (solution);
   bool satisfied = false;
   vector<int> & clause = internal->clause;
   const const_int_iterator end = clause.end ();
-  for (const_int_iterator i = clause.begin (); !satisfied && i != end; i++)
-    satisfied = (sol (internal->externalize (*i)) > 0);
+  for (const_int_iterator i = clause.begin (); !satisfied && i != end; i++) {
+    const int elit = internal->externalize (*i);
+    satisfied = !elit || sol (elit) > 0;
+  }
   if (satisfied) return;
   fflush (stdout);
   fputs (
@@ -32,8 +38,10 @@ void External::check_solution_on_shrunken_clause (Clause * c) {
   assert (solution);
   bool satisfied = false;
   const const_literal_iterator end = c->end ();
-  for (const_literal_iterator i = c->begin (); !satisfied && i != end; i++)
-    satisfied = (sol (internal->externalize (*i)) < 0);
+  for (const_literal_iterator i = c->begin (); !satisfied && i != end; i++) {
+    const int elit = internal->externalize (*i);
+    satisfied = !elit || sol (elit) < 0;
+  }
   if (satisfied) return;
   fflush (stdout);
   fputs (
@@ -44,16 +44,32 @@ void Stats::print (Internal * internal) {
   propagations += stats.propagations.transred;
   propagations += stats.propagations.probe;
   propagations += stats.propagations.vivify;
+  long ticks = stats.ticks.search + stats.ticks.probe + stats.ticks.bva;
+  ticks += stats.ticks.elim + stats.ticks.subsume;
+  ticks += stats.ticks.transred + stats.ticks.vivify + stats.ticks.walk;
   long vivified = stats.vivifysubs + stats.vivifystrs;
-  long learned = stats.learned - stats.minimized;
+  long learned = stats.learned - stats.minimized - stats.shrunken;
+  learned -= stats.binminimized;
   size_t extendbytes = internal->external->extension.capacity ();
   extendbytes *= sizeof (int);
 
   SECTION ("statistics");
 
+  PRT ("atmosts:         %15ld   %10.2f    conflicts per constraint", stats.atmost.added, relative (stats.atmost.conflicts, stats.atmost.added));
+  PRT ("  atassigned:    %15ld   %10.2f %%  of propagations", stats.atmost.assigned, percent (stats.atmost.assigned, stats.propagations.search));
+  PRT ("  atconflicts:   %15ld   %10.2f %%  of conflicts", stats.atmost.conflicts, percent (stats.atmost.conflicts, stats.conflicts));
+  PRT ("  atexplained:   %15ld   %10.2f %%  of assigned", stats.atmost.explained, percent (stats.atmost.explained, stats.atmost.assigned));
+  PRT ("backbone:        %15ld   %10.2f    per test", stats.backbone.literals, relative (stats.backbone.literals, stats.backbone.tests));
+  PRT ("  bbtests:       %15ld   %10.2f    conflicts per test", stats.backbone.tests, relative (stats.conflicts, stats.backbone.tests));
   PRT ("bumped:          %15ld   %10.2f    per conflict", stats.bumped, relative (stats.bumped, stats.conflicts));
+  PRT ("bva:             %15ld   %10.2f    conflicts per round", stats.bva.count, relative (stats.conflicts, stats.bva.count));
+  PRT ("  bvavars:       %15ld   %10.2f    per round", stats.bva.vars, relative (stats.bva.vars, stats.bva.count));
+  PRT ("  bvareduced:    %15ld   %10.2f    clauses per variable", stats.bva.reduced, relative (stats.bva.reduced, stats.bva.vars));
+  PRT ("blocked:         %15ld   %10.2f    conflicts per model", stats.blocked, relative (stats.conflicts, stats.blocked));
   PRT ("compacts:        %15ld   %10.2f    conflicts per compact", stats.compacts, relative (stats.conflicts, stats.compacts));
   PRT ("conflicts:       %15ld   %10.2f    per second", stats.conflicts, relative (stats.conflicts, t));
+  PRT ("coretests:       %15ld   %10.2f    conflicts per test", stats.core.tests, relative (stats.conflicts, stats.core.tests));
+  PRT ("  coreremoved:   %15ld   %10.2f    per test", stats.core.removed, relative (stats.core.removed, stats.core.tests));
   PRT ("decisions:       %15ld   %10.2f    per second", stats.decisions, relative (stats.decisions, t));
   PRT ("decompositions:  %15ld   %10.2f    decompositions per probing", stats.decompositions, relative (stats.decompositions, stats.probings));
   PRT ("eliminated:      %15ld   %10.2f %%  of all variables", stats.all.eliminated, percent (stats.all.eliminated, max_var));
@@ -62,15 +78,29 @@ void Stats::print (Internal * internal) {
   PRT ("fixed:           %15ld   %10.2f %%  of all variables", stats.all.fixed, percent (stats.all.fixed, max_var));
   PRT ("  units:         %15ld   %10.2f    conflicts per unit", stats.units, relative (stats.conflicts, stats.units));
   PRT ("  binaries:      %15ld   %10.2f    conflicts per binary", stats.binaries, relative (stats.conflicts, stats.binaries));
+  PRT ("gauss:           %15ld   %10.2f    conflicts per round", stats.gauss.rounds, relative (stats.conflicts, stats.gauss.rounds));
+  PRT ("  gadetected:    %15ld   %10.2f    per round", stats.gauss.detected, relative (stats.gauss.detected, stats.gauss.rounds));
+  PRT ("  garows:        %15ld   %10.2f    per round", stats.gauss.rows, relative (stats.gauss.rows, stats.gauss.rounds));
+  PRT ("  gaunits:       %15ld   %10.2f    per round", stats.gauss.units, relative (stats.gauss.units, stats.gauss.rounds));
+  PRT ("  gabinaries:    %15ld   %10.2f    per round", stats.gauss.binaries, relative (stats.gauss.binaries, stats.gauss.rounds));
+  PRT ("  gaxors:        %15ld   %10.2f    per round", stats.gauss.xors, relative (stats.gauss.xors, stats.gauss.rounds));
   PRT ("learned:         %15ld   %10.2f    per conflict", learned, relative (learned, stats.conflicts));
   PRT ("memory:          %15ld   %10.2f    bytes and MB", m, m/(double)(1l<<20));
   PRT ("minimized:       %15ld   %10.2f %%  of 1st-UIP-literals", stats.minimized, percent (stats.minimized, stats.learned));
+  PRT ("  binminimized:  %15ld   %10.2f %%  of 1st-UIP-literals", stats.binminimized, percent (stats.binminimized, stats.learned));
+  PRT ("optcores:        %15ld   %10.2f    conflicts per core", stats.optimize.cores, relative (stats.conflicts, stats.optimize.cores));
+  PRT ("  optmodels:     %15ld   %10.2f    conflicts per model", stats.optimize.models, relative (stats.conflicts, stats.optimize.models));
+  PRT ("  optoutputs:    %15ld   %10.2f    per core", stats.optimize.outputs, relative (stats.optimize.outputs, stats.optimize.cores));
+  PRT ("popped:          %15ld   %10.2f    conflicts per pop", stats.popped.groups, relative (stats.conflicts, stats.popped.groups));
+  PRT ("  popclauses:    %15ld   %10.2f    per pop", stats.popped.clauses, relative (stats.popped.clauses, stats.popped.groups));
   PRT ("probings:        %15ld   %10.2f    conflicts per probing", stats.probings, relative (stats.conflicts, stats.probings));
   PRT ("probed:          %15ld   %10.2f    per failed", stats.probed, relative (stats.probed, stats.failed));
   PRT ("  hbrs:          %15ld   %10.2f    per probed", stats.hbrs, relative (stats.hbrs, stats.probed));
   PRT ("  hbrsizes:      %15ld   %10.2f    per hbr", stats.hbrsizes, relative (stats.hbrsizes, stats.hbrs));
   PRT ("  hbreds:        %15ld   %10.2f %%  per hbr", stats.hbreds, percent (stats.hbreds, stats.hbrs));
   PRT ("  hbrsubs:       %15ld   %10.2f %%  per hbr", stats.hbrsubs, percent (stats.hbrsubs, stats.hbrs));
+  PRT ("promoted:        %15ld   %10.2f %%  per recomputed glue", stats.promoted, percent (stats.promoted, stats.recomputed));
+  PRT ("  recomputed:    %15ld   %10.2f    per conflict", stats.recomputed, relative (stats.recomputed, stats.conflicts));
   PRT ("propagations:    %15ld   %10.2f    millions per second", propagations, relative (propagations/1e6, t));
   PRT ("  searchprops:   %15ld   %10.2f %%  of propagations", stats.propagations.search, percent (stats.propagations.search, propagations));
   PRT ("  transredprops: %15ld   %10.2f %%  of propagations", stats.propagations.transred, percent (stats.propagations.transred, propagations));
@@ -78,17 +108,30 @@ void Stats::print (Internal * internal) {
   PRT ("  vivifyprops:   %15ld   %10.2f %%  of propagations", stats.propagations.vivify, percent (stats.propagations.vivify, propagations));
   SSG ("  visits:        %15ld   %10.2f    per searchprop", stats.visits, relative (stats.visits, stats.propagations.search));
   SSG ("  traversed:     %15ld   %10.2f    per visit", stats.traversed, relative (stats.traversed, stats.visits));
+  PRT ("reactivated:     %15ld   %10.2f    per restoration", stats.reactivated, relative (stats.reactivated, stats.restorations));
   PRT ("reduced:         %15ld   %10.2f %%  clauses per conflict", stats.reduced, percent (stats.reduced, stats.conflicts));
   PRT ("  collections:   %15ld   %10.2f    conflicts per collection", stats.collections, relative (stats.conflicts, stats.collections));
   PRT ("  extendbytes:   %15ld   %10.2f    bytes and MB", extendbytes, extendbytes/(double)(1l<<20));
   PRT ("reductions:      %15ld   %10.2f    conflicts per reduction", stats.reductions, relative (stats.conflicts, stats.reductions));
-  PRT ("rephased:        %15ld   %10.2f    conflicts per rephase", stats.rephased, relative (stats.conflicts, stats.rephased));
+  PRT ("rephased:        %15ld   %10.2f    conflicts per rephase", stats.rephased.total, relative (stats.conflicts, stats.rephased.total));
+  PRT ("  rephorig:      %15ld   %10.2f %%  of rephases", stats.rephased.original, percent (stats.rephased.original, stats.rephased.total));
+  PRT ("  rephinv:       %15ld   %10.2f %%  of rephases", stats.rephased.inverted, percent (stats.rephased.inverted, stats.rephased.total));
+  PRT ("  rephwalk:      %15ld   %10.2f %%  of rephases", stats.rephased.walk, percent (stats.rephased.walk, stats.rephased.total));
+  PRT ("  rephbest:      %15ld   %10.2f %%  of rephases", stats.rephased.best, percent (stats.rephased.best, stats.rephased.total));
   PRT ("resolutions:     %15ld   %10.2f    per eliminated", stats.elimres, relative (stats.elimres, stats.all.eliminated));
   PRT ("  elimres2:      %15ld   %10.2f %%  per resolved", stats.elimres2, percent (stats.elimres, stats.elimres));
   PRT ("  elimrestried:  %15ld   %10.2f %%  per resolved", stats.elimrestried, percent (stats.elimrestried, stats.elimres));
+  PRT ("rescored:        %15ld   %10.2f    conflicts per rescore", stats.rescored, relative (stats.conflicts, stats.rescored));
   PRT ("restarts:        %15ld   %10.2f    conflicts per restart", stats.restarts, relative (stats.conflicts, stats.restarts));
+  PRT ("restorations:    %15ld   %10.2f    conflicts per restoration", stats.restorations, relative (stats.conflicts, stats.restorations));
   PRT ("reused:          %15ld   %10.2f %%  per restart", stats.reused, percent (stats.reused, stats.restarts));
   PRT ("searched:        %15ld   %10.2f    per decision", stats.searched, relative (stats.searched, stats.decisions));
+  PRT ("shrunken:        %15ld   %10.2f %%  of 1st-UIP-literals", stats.shrunken, percent (stats.shrunken, stats.learned));
+  PRT ("  shrunk:        %15ld   %10.2f    per conflict", stats.shrunk, relative (stats.shrunk, stats.conflicts));
+  PRT ("solves:          %15ld   %10.2f    conflicts per solve", stats.solves, relative (stats.conflicts, stats.solves));
+  PRT ("stabilized:      %15ld   %10.2f    conflicts per phase", stats.stable.phases, relative (stats.stable.conflicts, stats.stable.phases));
+  PRT ("  stabconflicts: %15ld   %10.2f %%  of conflicts", stats.stable.conflicts, percent (stats.stable.conflicts, stats.conflicts));
+  PRT ("  stabrestarts:  %15ld   %10.2f %%  of restarts", stats.stable.restarts, percent (stats.stable.restarts, stats.restarts));
   PRT ("strengthened:    %15ld   %10.2f    per subsumed", stats.strengthened, relative (stats.strengthened, stats.subsumed));
   PRT ("  subirr:        %15ld   %10.2f %%  of subsumed", stats.subirr, percent (stats.subirr, stats.subsumed));
   PRT ("  subred:        %15ld   %10.2f %%  of subsumed", stats.subred, percent (stats.subred, stats.subsumed));
@@ -100,6 +143,15 @@ void Stats::print (Internal * internal) {
   PRT ("  duplicated:    %15ld   %10.2f %%  per subsumed", stats.duplicated, percent (stats.duplicated, stats.subsumed));
   PRT ("  transitive:    %15ld   %10.2f %%  per subsumed", stats.transitive, percent (stats.transitive, stats.subsumed));
   PRT ("subsumptions:    %15ld   %10.2f    conflicts per subsumption", stats.subsumptions, relative (stats.conflicts, stats.subsumptions));
+  PRT ("ticks:           %15ld   %10.2f    per propagation", ticks, relative (ticks, propagations));
+  PRT ("  searchticks:   %15ld   %10.2f %%  of ticks", stats.ticks.search, percent (stats.ticks.search, ticks));
+  PRT ("  bvaticks:      %15ld   %10.2f %%  of ticks", stats.ticks.bva, percent (stats.ticks.bva, ticks));
+  PRT ("  elimticks:     %15ld   %10.2f %%  of ticks", stats.ticks.elim, percent (stats.ticks.elim, ticks));
+  PRT ("  probeticks:    %15ld   %10.2f %%  of ticks", stats.ticks.probe, percent (stats.ticks.probe, ticks));
+  PRT ("  subsumeticks:  %15ld   %10.2f %%  of ticks", stats.ticks.subsume, percent (stats.ticks.subsume, ticks));
+  PRT ("  transredticks: %15ld   %10.2f %%  of ticks", stats.ticks.transred, percent (stats.ticks.transred, ticks));
+  PRT ("  vivifyticks:   %15ld   %10.2f %%  of ticks", stats.ticks.vivify, percent (stats.ticks.vivify, ticks));
+  PRT ("  walkticks:     %15ld   %10.2f %%  of ticks", stats.ticks.walk, percent (stats.ticks.walk, ticks));
   PRT ("time:            %15s   %10.2f    seconds", "", t);
   PRT ("transreductions: %15ld   %10.2f    conflicts per reduction", stats.transreds, relative (stats.conflicts, stats.transreds));
   PRT ("vivifications:   %15ld   %10.2f    conflicts per vivification", stats.vivifications, relative (stats.conflicts, stats.vivifications));
@@ -111,6 +163,14 @@ void Stats::print (Internal * internal) {
   PRT ("  vivifystrs:    %15ld   %10.2f %%  per strengthened", stats.vivifystrs, percent (stats.vivifystrs, stats.strengthened));
   PRT ("  vivifydecs:    %15ld   %10.2f    per checks", stats.vivifydecs, relative (stats.vivifydecs, stats.vivifychecks));
   PRT ("  vivifyreused:  %15ld   %10.2f %%  per decision", stats.vivifyreused, percent (stats.vivifyreused, stats.vivifydecs));
+  PRT ("walked:          %15ld   %10.2f    conflicts per walk", stats.walk.count, relative (stats.conflicts, stats.walk.count));
+  PRT ("  walkflips:     %15ld   %10.2f    per walk", stats.walk.flips, relative (stats.walk.flips, stats.walk.count));
+  PRT ("  walkbroken:    %15ld   %10.2f    per walk", stats.walk.broken, relative (stats.walk.broken, stats.walk.count));
+  PRT ("  walkmodels:    %15ld   %10.2f %%  of walks", stats.walk.models, percent (stats.walk.models, stats.walk.count));
+  PRT ("xors:            %15ld   %10.2f    conflicts per constraint", stats.xors.added, relative (stats.xors.conflicts, stats.xors.added));
+  PRT ("  xorassigned:   %15ld   %10.2f %%  of propagations", stats.xors.assigned, percent (stats.xors.assigned, stats.propagations.search));
+  PRT ("  xorconflicts:  %15ld   %10.2f %%  of conflicts", stats.xors.conflicts, percent (stats.xors.conflicts, stats.conflicts));
+  PRT ("  xorexplained:  %15ld   %10.2f %%  of assigned", stats.xors.explained, percent (stats.xors.explained, stats.xors.assigned));
 
   PRT ("");
 
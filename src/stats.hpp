@@ -12,6 +12,7 @@ struct Stats {
 
   Internal * internal;
 
+  long solves;       // number of calls to 'solve'
   long conflicts;    // generated conflicts in 'propagate'
   long decisions;    // number of decisions in 'decide'
 
@@ -22,10 +23,89 @@ struct Stats {
     long transred;   // propagated during transitive reduction
   } propagations;
 
+  // Effort in 'ticks', roughly the number of cache lines accessed, which
+  // is used to bound inprocessing relative to search (see 'propagate').
+  //
+  struct {
+    long search;     // ticks in search propagation
+    long bva;        // ticks during bounded variable addition
+    long elim;       // ticks during bounded variable elimination
+    long probe;      // ticks in probing propagation
+    long subsume;    // ticks during subsumption
+    long transred;   // ticks during transitive reduction
+    long vivify;     // ticks during vivification
+    long walk;       // ticks during local search
+  } ticks;
+
   long compacts;     // number of compactifications
-  long rephased;     // actual number of happened rephases
+  struct {
+    long count;      // number of bounded variable addition rounds
+    long vars;       // added variables
+    long reduced;    // removed clauses minus added clauses
+  } bva;
+  struct {
+    long total;      // actual number of happened rephases
+    long original;   // reset to original phase
+    long inverted;   // reset to inverted original phase
+    long best;       // reset to best phases
+    long walk;       // reset to phases found by local search
+  } rephased;
+  struct {
+    long count;      // number of local search rounds
+    long flips;      // flipped variables during local search
+    long broken;     // sum of minimum number of broken clauses
+    long models;     // local search rounds satisfying all clauses
+  } walk;
+  long rescored;     // number of EVSIDS score rescalings
+  long recomputed;   // glue recomputations of learned clauses
+  long promoted;     // learned clauses promoted to core clauses
   long restarts;     // actual number of happened restarts
   long reused;       // number of reused trails
+  long restorations; // number of 'restore_clauses' calls
+  long reactivated;  // reactivated variables in 'restore_clauses'
+  long blocked;      // blocked projected models in 'enumerate'
+  struct {
+    long phases;     // number of stable mode phases
+    long conflicts;  // conflicts in stable mode
+    long restarts;   // restarts in stable mode
+  } stable;
+  struct {
+    long added;      // added cardinality constraints
+    long assigned;   // literals assigned by cardinality constraints
+    long conflicts;  // conflicts of cardinality constraints
+    long explained;  // explanation clauses of assigned literals
+  } atmost;
+  struct {
+    long cores;      // cores found in 'optimize'
+    long models;     // improving models found in 'optimize'
+    long outputs;    // totalizer outputs
+  } optimize;
+  struct {
+    long added;      // added parity constraints
+    long assigned;   // literals assigned by parity constraints
+    long conflicts;  // conflicts of parity constraints
+    long explained;  // explanation clauses of assigned literals
+  } xors;
+  struct {
+    long rounds;     // Gaussian elimination rounds
+    long detected;   // parity constraints detected in clauses
+    long rows;       // rows of all eliminated matrices
+    long units;      // units found by Gaussian elimination
+    long binaries;   // binary clauses of found equivalences
+    long xors;       // kept redundant parity constraints
+  } gauss;
+  struct {
+    long groups;     // popped clause groups
+    long clauses;    // clauses in popped groups
+  } popped;
+  struct {
+    long tests;      // deletion tests in core minimization
+    long removed;    // removed core elements
+  } core;
+  struct {
+    long literals;   // backbone literals found by 'backbone'
+    long tests;      // backbone candidate tests
+  } backbone;
   long reports;      // 'report' counter
   long sections;     // 'section' counter
   long added;        // irredundant clauses
@@ -67,6 +147,9 @@ struct Stats {
   long transitive;
   long learned;      // learned literals
   long minimized;    // minimized literals
+  long binminimized; // minimized literals with binary clauses
+  long shrunken;     // shrunken literals
+  long shrunk;       // learned clause blocks shrunken to one literal
   long redundant;    // number of current redundant clauses
   long irredundant;  // number of current irredundant clauses
   long irrbytes;     // bytes of irredundant clauses
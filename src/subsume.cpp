@@ -86,6 +86,7 @@ Internal::subsume_clause (Clause * subsuming, Clause * subsumed) {
   if (subsumed->redundant || !subsuming->redundant) return;
   LOG ("turning redundant subsuming clause into irredundant clause");
   subsuming->redundant = false;
+  subsuming->keep = true;
   stats.irredundant++;
   stats.irrbytes += subsuming->bytes ();
   assert (stats.redundant > 0);
@@ -155,6 +156,7 @@ Internal::try_to_subsume_clause (Clause * c, vector<Clause *> & shrunken) {
       // literal.
       //
       Bins & bs = bins (sign*lit);
+      stats.ticks.subsume += 1 + cache_lines (bs.size (), sizeof (int));
       const const_bins_iterator eb = bs.end ();
       const_bins_iterator b;
       for (b = bs.begin (); !d && b != eb; b++) {
@@ -185,11 +187,13 @@ Internal::try_to_subsume_clause (Clause * c, vector<Clause *> & shrunken) {
       // code after the loop.
       //
       Occs & os = occs (sign * lit);
+      stats.ticks.subsume += 1 + cache_lines (os.size (), sizeof (Clause*));
       const const_occs_iterator eo = os.end ();
       occs_iterator k = os.begin ();
       for (const_occs_iterator j = k; j != eo; j++) {
         Clause * e = *k++ = *j;
         if (d) continue;                        // need to copy rest
+        stats.ticks.subsume++;
         if (e->garbage) { k--; continue; }
         flipped = subsume_check (e, c);
         if (!flipped) continue;
@@ -347,6 +351,17 @@ void Internal::subsume_round () {
 
   long subsumed = 0, strengthened = 0;
 
+  // Huge occurrence lists make a complete round too costly.  Thus the
+  // ticks of traversing occurrence lists and visiting clauses are limited
+  // in the same way as in 'probe'.
+  //
+  long delta = stats.ticks.search;
+  delta -= lim.search_ticks.subsume;
+  delta *= opts.subsumereleff;
+  if (delta < opts.subsumemineff) delta = opts.subsumemineff;
+  if (delta > opts.subsumemaxeff) delta = opts.subsumemaxeff;
+  long limit = stats.ticks.subsume + delta;
+
   const const_clause_size_iterator eos = schedule.end ();
   const_clause_size_iterator s;
 
@@ -354,7 +369,9 @@ void Internal::subsume_round () {
   init_occs ();
   init_bins ();
 
-  for (s = schedule.begin (); s != eos; s++) {
+  for (s = schedule.begin ();
+       s != eos && stats.ticks.subsume < limit;
+       s++) {
 
     Clause * c = clauses[s->cidx];
     assert (!c->garbage);
@@ -446,6 +463,12 @@ void Internal::subsume_round () {
     subsumed, strengthened, scheduled,
     percent (subsumed + strengthened, scheduled));
 
+  const bool completed = (s == eos);
+  if (!completed)
+    VRB ("subsume", stats.subsumptions,
+      "tick limit hit after %ld of %ld clauses",
+      (long) (s - schedule.begin ()), scheduled);
+
   // Release occurrence lists and schedule.
   //
   erase_vector (schedule);
@@ -454,9 +477,11 @@ void Internal::subsume_round () {
   reset_bins ();
 
   // Reset all old 'added' flags and mark variables in shrunken
-  // clauses as 'added' for the next subsumption round.
+  // clauses as 'added' for the next subsumption round.  If the round was
+  // not completed the old flags are kept, such that the remaining
+  // candidates are tried again.
   //
-  reset_added ();
+  if (completed) reset_added ();
   for (const_clause_iterator i = shrunken.begin ();
        i != shrunken.end ();
        i++)
@@ -468,6 +493,7 @@ void Internal::subsume_round () {
   // from 'subsume' below, then this limit will again be overwritten.
   //
   lim.subsume = stats.conflicts + inc.subsume;
+  lim.search_ticks.subsume = stats.ticks.search;
 
   report ('s');
   STOP_AND_SWITCH (subsume, simplify, search);
@@ -48,17 +48,17 @@ void Internal::transred () {
   vector<int> work;
 
   // Transitive reduction can not be run to completion for larger formulas
-  // with many binary clauses.  We bound it in the same way as 'prob_core'.
+  // with many binary clauses.  We bound it in the same way as 'probe'.
   //
-  long limit = stats.propagations.search;
-  limit -= lim.search_propagations.transred;
+  long limit = stats.ticks.search;
+  limit -= lim.search_ticks.transred;
   limit *= opts.transredreleff;
   if (limit < opts.transredmineff) limit = opts.transredmineff;
   if (limit > opts.transredmaxeff) limit = opts.transredmaxeff;
 
-  long propagations = 0, units = 0, removed = 0;
+  long propagations = 0, ticks = 0, units = 0, removed = 0;
 
-  while (!unsat && i != end && propagations < limit) {
+  while (!unsat && i != end && ticks < limit) {
     Clause * c = *i++;
 
     // A clause is a candidate for being transitive if it is binary, and not
@@ -114,6 +114,7 @@ void Internal::transred () {
       LOG ("transred propagating %d", lit);
       propagations++;
       const Watches & ws = watches (-lit);
+      ticks += 1 + cache_lines (ws.size (), sizeof (Watch));
       const const_watch_iterator eow = ws.end ();
       const_watch_iterator k;
       for (k = ws.begin (); !transitive && !failed && k != eow; k++) {
@@ -165,8 +166,9 @@ void Internal::transred () {
     }
   }
 
-  lim.search_propagations.transred = stats.propagations.search;
+  lim.search_ticks.transred = stats.ticks.search;
   stats.propagations.transred += propagations;
+  stats.ticks.transred += ticks;
   erase_vector (work);
 
   VRB ("transred", stats.transreds,
@@ -12,6 +12,7 @@ using namespace std;
 inline double relative (double a, double b) { return b ? a / b : 0; }
 inline double percent (double a, double b) { return relative (100 * a, b); }
 inline int sign (int lit) { return (lit > 0) - (lit < 0); }
+inline int bign (int lit) { return 1 + (lit < 0); }
 
 /*------------------------------------------------------------------------*/
 
@@ -46,6 +47,13 @@ inline size_t align (size_t bytes, size_t alignment) {
   else return (bytes | (alignment - 1)) + 1;
 }
 
+// Number of (64 byte) cache lines touched by traversing 'n' elements of
+// 'bytes' size each, used to measure effort in 'ticks'.
+
+inline size_t cache_lines (size_t n, size_t bytes) {
+  return (n * bytes + 63) >> 6;
+}
+
 /*------------------------------------------------------------------------*/
 
 // The standard 'Effective STL' way (though not guaranteed) to clear a
@@ -237,21 +237,21 @@ void Internal::vivify () {
   //
   long checked = 0, subsumed = 0, strengthened = 0, units = 0;
 
-  // Limit the number of propagations during vivification as in 'probe'.
+  // Limit the number of ticks during vivification as in 'probe'.
   //
-  long delta = stats.propagations.search;
-  delta -= lim.search_propagations.vivify;
+  long delta = stats.ticks.search;
+  delta -= lim.search_ticks.vivify;
   delta *= opts.vivifyreleff;
   if (delta < opts.vivifymineff) delta = opts.vivifymineff;
   if (delta > opts.vivifymaxeff) delta = opts.vivifymaxeff;
-  long limit = stats.propagations.vivify + delta;
+  long limit = stats.ticks.vivify + delta;
 
   connect_watches (true);		// watch only irredundant clauses
   vector<int> sorted;			// sort literals of each candidate
 
   while (!unsat &&
          !schedule.empty () &&
-         stats.propagations.vivify < limit) {
+         stats.ticks.vivify < limit) {
 
     // Next candidate clause to vivify.
     //
@@ -535,7 +535,7 @@ void Internal::vivify () {
   stats.subsumed += subsumed;
   stats.strengthened += strengthened;
 
-  lim.search_propagations.vivify = stats.propagations.search;
+  lim.search_ticks.vivify = stats.ticks.search;
 
   assert (vivifying);
   vivifying = false;
@@ -0,0 +1,288 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Local search with ProbSAT as described by Balint and Schoening in their
+// SAT'12 paper.  It is used during 'rephase' to find better phases, starting
+// from the saved phases.  In each step a random unsatisfied (broken) clause
+// is picked and one of its literals is flipped, where the probability of
+// picking a literal decreases exponentially with its break count, i.e., the
+// number of clauses which would become unsatisfied by flipping it.
+
+// Local search works on a copy of the irredundant clauses without root
+// level assigned literals in a compact flat layout, independent of the
+// arena and watches.  For each clause the number of true literals is kept
+// and the 'critical' literal, which is the exclusive or of all true
+// literals and thus the only true literal if the count is one.  This allows
+// to update break counts of variables incrementally while flipping.
+
+// Flips since the last best assignment are recorded in 'flips', such that
+// the best assignment can be restored at the end.  If there are too many
+// flips, recording stops until the next improvement, which then copies the
+// whole assignment.  Native cardinality and parity constraints are
+// ignored, since the result is only used as phases.  If all clauses are
+// satisfied, the next decisions in 'search' find a model right away.
+
+struct Walker {
+
+  Internal * internal;
+
+  vector<int> literals;         // literals of all clauses
+  vector<int> start;            // start of clauses in 'literals'
+  vector<int> occs_start;       // start of literals in 'occs'
+  vector<int> occs;             // clause indices of literal occurrences
+  vector<int> count;            // number of true literals in clause
+  vector<unsigned> critical;    // exclusive or of true literals
+  vector<int> broken;           // unsatisfied clauses
+  vector<int> position;         // position of clause in 'broken'
+  vector<int> breaks;           // break count of variables
+  vector<signed char> values;   // current assignment
+  vector<signed char> best;     // best assignment up to 'best_flips'
+  vector<int> flips;            // flipped variables since 'best'
+  long best_flips;              // negative if 'flips' are not recorded
+  size_t minimum;               // minimum number of broken clauses
+  vector<double> table;         // probability of break counts
+  vector<double> scores;        // probability of clause literals
+  uint64_t random;              // state of random number generator
+  long ticks;                   // number of occurrences traversed
+
+  Walker (Internal * i, uint64_t seed) :
+    internal (i), best_flips (0), minimum (0), random (seed), ticks (0)
+  { }
+
+  static unsigned ulit (int lit) { return 2u*abs (lit) + (lit < 0); }
+
+  unsigned next () {
+    random = random * 6364136223846793005ul + 1442695040888963407ul;
+    return random >> 32;
+  }
+
+  double uniform () { return next () / 4294967296.0; }
+
+  bool is_true (int lit) const {
+    const int tmp = values[abs (lit)];
+    return lit < 0 ? tmp < 0 : tmp > 0;
+  }
+
+  void make_broken (int c) {
+    position[c] = broken.size ();
+    broken.push_back (c);
+  }
+
+  void make_satisfied (int c) {
+    const int last = broken.back ();
+    const int pos = position[c];
+    broken[pos] = last;
+    position[last] = pos;
+    broken.pop_back ();
+    position[c] = -1;
+  }
+
+  void init_table (double average_size);
+  void import_clauses ();
+  void init_counts ();
+  int pick_literal (int c);
+  void flip (int lit);
+  void save_best ();
+  void restore_best ();
+};
+
+/*------------------------------------------------------------------------*/
+
+// The base of the exponential distribution depends on the average clause
+// size as suggested in the ProbSAT paper.
+
+void Walker::init_table (double average_size) {
+  static const double bases[] = { 2.0, 2.0, 2.0, 2.5, 2.85, 3.7, 5.1, 7.4 };
+  const int size = (int) (average_size + 0.5);
+  const double base = bases[size < 7 ? size : 7];
+  double p = 1;
+  while (p > 1e-300) table.push_back (p), p /= base;
+  LOG ("walk break table size %ld with base %g",
+    (long) table.size (), base);
+}
+
+void Walker::import_clauses () {
+  const int max_var = internal->max_var;
+  occs_start.resize (2*max_var + 3, 0);
+  const const_clause_iterator eoc = internal->clauses.end ();
+  const_clause_iterator i;
+  for (i = internal->clauses.begin (); i != eoc; i++) {
+    Clause * c = *i;
+    if (c->garbage || c->redundant) continue;
+    const const_literal_iterator eol = c->end ();
+    const_literal_iterator j;
+    for (j = c->begin (); j != eol; j++)
+      if (internal->val (*j) > 0) break;
+    if (j != eol) continue;
+    start.push_back (literals.size ());
+    for (j = c->begin (); j != eol; j++) {
+      const int lit = *j;
+      if (internal->val (lit)) continue;
+      literals.push_back (lit);
+      occs_start[ulit (lit) + 1]++;
+    }
+    assert ((int) literals.size () > start.back ());
+  }
+  const int n = start.size ();
+  start.push_back (literals.size ());
+  for (size_t u = 1; u < occs_start.size (); u++)
+    occs_start[u] += occs_start[u-1];
+  occs.resize (literals.size ());
+  vector<int> pos (occs_start.begin (), occs_start.end () - 1);
+  for (int c = 0; c < n; c++)
+    for (int k = start[c]; k < start[c+1]; k++)
+      occs[pos[ulit (literals[k])]++] = c;
+  const double average = n ? literals.size () / (double) n : 0;
+  init_table (average);
+}
+
+void Walker::init_counts () {
+  const int n = start.size () - 1;
+  count.resize (n, 0);
+  critical.resize (n, 0);
+  position.resize (n, -1);
+  breaks.resize (internal->max_var + 1, 0);
+  for (int c = 0; c < n; c++) {
+    for (int k = start[c]; k < start[c+1]; k++) {
+      const int lit = literals[k];
+      if (!is_true (lit)) continue;
+      count[c]++;
+      critical[c] ^= ulit (lit);
+    }
+    if (!count[c]) make_broken (c);
+    else if (count[c] == 1) breaks[critical[c]/2]++;
+  }
+  minimum = broken.size ();
+  best = values;
+}
+
+/*------------------------------------------------------------------------*/
+
+int Walker::pick_literal (int c) {
+  const int size = start[c+1] - start[c];
+  const int * lits = &literals[start[c]];
+  const int max_break = table.size () - 1;
+  double sum = 0;
+  scores.clear ();
+  for (int k = 0; k < size; k++) {
+    const int b = breaks[abs (lits[k])];
+    const double score = table[b < max_break ? b : max_break];
+    scores.push_back (score);
+    sum += score;
+  }
+  const double limit = sum * uniform ();
+  double prefix = 0;
+  int k;
+  for (k = 0; k + 1 < size; k++)
+    if ((prefix += scores[k]) > limit) break;
+  return lits[k];
+}
+
+// Make the false literal 'lit' true and update counts, critical literals,
+// break counts and the set of broken clauses.
+
+void Walker::flip (int lit) {
+  assert (!is_true (lit));
+  const int idx = abs (lit);
+  values[idx] = lit < 0 ? -1 : 1;
+  const unsigned u = ulit (lit), v = ulit (-lit);
+  for (int k = occs_start[u]; k < occs_start[u+1]; k++) {
+    const int c = occs[k];
+    critical[c] ^= u;
+    const int tmp = ++count[c];
+    if (tmp == 1) make_satisfied (c), breaks[idx]++;
+    else if (tmp == 2) breaks[(critical[c] ^ u)/2]--;
+  }
+  for (int k = occs_start[v]; k < occs_start[v+1]; k++) {
+    const int c = occs[k];
+    critical[c] ^= v;
+    const int tmp = --count[c];
+    if (!tmp) make_broken (c), breaks[idx]--;
+    else if (tmp == 1) breaks[critical[c]/2]++;
+  }
+  ticks += occs_start[u+1] - occs_start[u] + occs_start[v+1] - occs_start[v];
+  if (best_flips >= 0) {
+    flips.push_back (idx);
+    if (flips.size () > values.size () / 4) {
+      restore_best ();
+      best_flips = -1;
+    }
+  }
+}
+
+// The best assignment is 'best' with the first 'best_flips' of 'flips'
+// applied.  If flips are not recorded, the whole assignment is copied.
+
+void Walker::save_best () {
+  minimum = broken.size ();
+  if (best_flips < 0) {
+    best = values;
+    best_flips = 0;
+  } else best_flips = flips.size ();
+}
+
+void Walker::restore_best () {
+  assert (best_flips >= 0);
+  for (long i = 0; i < best_flips; i++) {
+    const int idx = flips[i];
+    best[idx] = -best[idx];
+  }
+  flips.clear ();
+  best_flips = 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::walk () {
+
+  assert (!level);
+  assert (!unsat);
+  if (!opts.walk) return;
+
+  START (walk);
+  stats.walk.count++;
+
+  long delta = stats.ticks.search;
+  delta -= lim.search_ticks.walk;
+  delta *= opts.walkreleff;
+  if (delta < opts.walkmineff) delta = opts.walkmineff;
+  if (delta > opts.walkmaxeff) delta = opts.walkmaxeff;
+
+  Walker walker (this, stats.walk.count);
+  walker.values.resize (max_var + 1, 0);
+  for (int idx = 1; idx <= max_var; idx++) {
+    const int tmp = val (idx);
+    walker.values[idx] = tmp ? tmp : phases[idx];
+  }
+  walker.import_clauses ();
+  walker.init_counts ();
+
+  const size_t initial = walker.minimum;
+  long flips = 0;
+  while (!walker.broken.empty () && walker.ticks < delta) {
+    const int c = walker.broken[walker.next () % walker.broken.size ()];
+    walker.flip (walker.pick_literal (c));
+    flips++;
+    if (walker.broken.size () < walker.minimum) walker.save_best ();
+  }
+  if (walker.best_flips >= 0) walker.restore_best ();
+
+  for (int idx = 1; idx <= max_var; idx++)
+    if (!val (idx)) phases[idx] = walker.best[idx];
+
+  stats.walk.flips += flips;
+  stats.walk.broken += walker.minimum;
+  if (!walker.minimum) stats.walk.models++;
+  stats.ticks.walk += walker.ticks;
+  lim.search_ticks.walk = stats.ticks.search;
+
+  VRB ("walk", stats.walk.count,
+    "%ld flips reduced broken clauses from %ld to %ld out of %ld",
+    flips, (long) initial, (long) walker.minimum,
+    (long) walker.start.size () - 1);
+
+  STOP (walk);
+}
+
+};
@@ -0,0 +1,272 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+// Native parity constraints stating that the sum modulo two of a set of
+// variables is a given 'parity'.  Encoding such a constraint directly into
+// clauses requires exponentially many clauses in its size, and thus long
+// constraints have to be split with auxiliary variables.  Instead they are
+// kept in occurrence lists of their variables and propagated like the
+// cardinality constraints in 'atmost.cpp' by counting assigned variables
+// (and summing up their values) on the trail before 'xor_propagated' (see
+// 'propagate_xors').  If all but one variable are assigned the remaining
+// one is forced.  If all are assigned but the sum differs from the parity
+// the constraint is in conflict.  Counts and sums are undone in
+// 'backtrack'.
+
+// As for cardinality constraints literals are assigned with the place
+// holder reason 'xor_reason', which is only replaced by an explanation
+// clause when needed (see 'explain_xor').  Parity constraints are not
+// propagated during inprocessing, their variables are frozen and proofs are
+// not supported.  However, they are used in Gaussian elimination together
+// with parity constraints found in clauses (see 'gauss.cpp').  The reduced
+// rows of the matrix are kept as redundant parity constraints, which are
+// propagated during search as the original ones (but not during
+// vivification, see 'propagate_xors').  Their variables are not frozen
+// though and thus they are disconnected as soon one of their variables is
+// eliminated or substituted (see 'mark_garbage_xors').
+
+void Internal::init_xors () {
+  assert (!xtab);
+  NEW_ZERO (xtab, Xors, vsize);
+}
+
+void Internal::reset_xors () {
+  assert (xtab);
+  RELEASE_DELETE (xtab, Xors, vsize);
+  xtab = 0;
+}
+
+void Internal::connect_xors () {
+  assert (xtab);
+  const const_xor_iterator end = xors.end ();
+  const_xor_iterator i;
+  for (i = xors.begin (); i != end; i++) {
+    Xor * x = *i;
+    const const_int_iterator eol = x->vars.end ();
+    const_int_iterator j;
+    for (j = x->vars.begin (); j != eol; j++)
+      xoccs (*j).push_back (x);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// The constraint states that an odd number of the literals is true.  Thus
+// negative literals flip the parity.  Duplicated variables cancel each
+// other and root level assigned variables are removed (flipping the parity
+// if true).  Constraints with less than three variables are turned into
+// units or binary clauses.
+
+void Internal::add_xor (const vector<int> & lits) {
+
+  assert (!proof);
+  if (level) backtrack ();
+  if (unsat) return;
+
+  assert (clause.empty ());
+  bool parity = true;
+  const const_int_iterator end = lits.end ();
+  const_int_iterator i;
+  for (i = lits.begin (); i != end; i++) {
+    const int lit = *i, idx = abs (lit), tmp = val (idx);
+    if (lit < 0) parity = !parity;
+    if (tmp > 0) parity = !parity;
+    else if (!tmp) clause.push_back (idx);
+  }
+  sort (clause.begin (), clause.end ());
+  int_iterator j = clause.begin ();
+  for (i = j; i != clause.end (); i++) {
+    if (i + 1 != clause.end () && i[0] == i[1]) i++;
+    else *j++ = *i;
+  }
+  clause.resize (j - clause.begin ());
+  const int size = (int) clause.size ();
+
+  LOG (clause, "adding parity constraint with parity %d on", (int) parity);
+
+  if (!size) {
+    if (parity) {
+      MSG ("parity constraint inconsistent with root level units");
+      unsat = true;
+    } else LOG ("trivially satisfied parity constraint");
+  } else if (size == 1) {
+    LOG ("parity constraint becomes unit");
+    assign_unit (parity ? clause[0] : -clause[0]);
+  } else if (size == 2) {
+    LOG ("parity constraint becomes two binary clauses");
+    const int a = clause[0], b = clause[1];
+    clause.clear ();
+    clause.push_back (a);
+    clause.push_back (parity ? b : -b);
+    add_new_original_clause ();
+    clause.clear ();
+    clause.push_back (-a);
+    clause.push_back (parity ? -b : b);
+    add_new_original_clause ();
+  } else {
+    if (!xtab) init_xors ();
+    stats.xors.added++;
+    Xor * x = new Xor (parity);
+    x->vars = clause;
+    xors.push_back (x);
+    for (i = clause.begin (); i != clause.end (); i++)
+      xoccs (*i).push_back (x);
+  }
+  clause.clear ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// The true literal 'lit' has been assigned by a parity constraint, of
+// which all other variables were assigned before.  The explanation clause
+// contains 'lit' as first literal and the negations of the values of all
+// other variables.  Any constraint with these properties and a matching
+// parity is sufficient.
+
+Clause * Internal::explain_xor (int lit) {
+  Var & v = var (lit);
+  assert (val (lit) > 0);
+  assert (v.reason == &xor_reason);
+  assert (explanation.empty ());
+  const int idx = abs (lit);
+  const Xors & xs = xoccs (idx);
+  const const_xor_iterator end = xs.end ();
+  const_xor_iterator i;
+  for (i = xs.begin (); i != end; i++) {
+    const Xor * x = *i;
+    bool sum = (lit > 0);
+    explanation.push_back (lit);
+    const const_int_iterator eol = x->vars.end ();
+    const_int_iterator j;
+    for (j = x->vars.begin (); j != eol; j++) {
+      const int other = *j;
+      if (other == idx) continue;
+      const int tmp = val (other);
+      if (!tmp || var (other).trail > v.trail) break;
+      if (tmp > 0) sum = !sum;
+      explanation.push_back (tmp < 0 ? other : -other);
+    }
+    if (j == eol && sum == x->parity) break;
+    explanation.clear ();
+  }
+  assert (i != end);
+  stats.xors.explained++;
+  Clause * res = new_explanation_clause ();
+  LOG (res, "explaining %d by", lit);
+  v.reason = res;
+  return res;
+}
+
+// The conflict clause contains the negations of the values of all
+// variables of the constraint.
+
+void Internal::xor_conflict (Xor * x) {
+  assert (!conflict);
+  assert (x->count == (int) x->vars.size ());
+  assert (x->sum != x->parity);
+  assert (explanation.empty ());
+  const const_int_iterator eol = x->vars.end ();
+  const_int_iterator j;
+  for (j = x->vars.begin (); j != eol; j++) {
+    const int idx = *j, tmp = val (idx);
+    assert (tmp);
+    explanation.push_back (tmp < 0 ? idx : -idx);
+  }
+  stats.xors.conflicts++;
+  conflict = new_explanation_clause ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Called from 'compact' on the root level after all literals on the trail
+// have been summed up.  Assigned variables are removed and constraints
+// with less than two variables left are deleted, since they are satisfied.
+
+void Internal::flush_xors () {
+  assert (!level);
+  assert (xtab);
+  assert (xor_propagated == trail.size ());
+  const const_xor_iterator end = xors.end ();
+  xor_iterator j = xors.begin ();
+  const_xor_iterator i;
+  for (i = j; i != end; i++) {
+    Xor * x = *i;
+    const const_int_iterator eol = x->vars.end ();
+    int_iterator k = x->vars.begin ();
+    const_int_iterator l;
+    for (l = k; l != eol; l++) {
+      const int idx = *l, tmp = val (idx);
+      if (!tmp) { *k++ = idx; continue; }
+      if (tmp > 0) x->parity = !x->parity, x->sum = !x->sum;
+      x->count--;
+    }
+    x->vars.resize (k - x->vars.begin ());
+    assert (!x->count), assert (!x->sum);
+    if (x->vars.size () > 1) *j++ = x;
+    else assert (x->vars.empty () && !x->parity), delete x;
+  }
+  xors.resize (j - xors.begin ());
+  reset_xors ();
+}
+
+// If a variable is eliminated or substituted, the redundant parity
+// constraints with this variable are disconnected immediately, since
+// otherwise propagating them might assign the removed variable.  They are
+// deleted afterwards in 'delete_garbage_xors'.  Original constraints only
+// contain frozen variables, which are neither eliminated nor substituted.
+
+void Internal::mark_garbage_xors (int idx) {
+  assert (0 < idx && idx <= max_var);
+  if (!xtab) return;
+  Xors & xs = xoccs (idx);
+  const const_xor_iterator end = xs.end ();
+  for (const_xor_iterator i = xs.begin (); i != end; i++) {
+    Xor * x = *i;
+    assert (x->redundant), assert (!x->garbage);
+    LOG (x->vars, "disconnecting redundant parity constraint");
+    x->garbage = true;
+    const const_int_iterator eol = x->vars.end ();
+    for (const_int_iterator j = x->vars.begin (); j != eol; j++) {
+      const int other = *j;
+      if (other == idx) continue;
+      Xors & ys = xoccs (other);
+      const xor_iterator k = find (ys.begin (), ys.end (), x);
+      assert (k != ys.end ());
+      ys.erase (k);
+    }
+  }
+  erase_vector (xs);
+}
+
+void Internal::delete_garbage_xors () {
+  const const_xor_iterator end = xors.end ();
+  xor_iterator j = xors.begin ();
+  const_xor_iterator i;
+  for (i = j; i != end; i++) {
+    Xor * x = *i;
+    if (x->garbage) delete x;
+    else *j++ = x;
+  }
+  xors.resize (j - xors.begin ());
+}
+
+// All redundant constraints are deleted before Gaussian elimination
+// derives new ones.  The occurrence lists are rebuilt, while the counts
+// and sums of the remaining constraints stay valid.
+
+void Internal::delete_redundant_xors () {
+  assert (!level);
+  if (!xtab) return;
+  const const_xor_iterator end = xors.end ();
+  const_xor_iterator i;
+  for (i = xors.begin (); i != end; i++) {
+    Xor * x = *i;
+    if (x->redundant) x->garbage = true;
+  }
+  delete_garbage_xors ();
+  reset_xors ();
+  if (!xors.empty ()) init_xors (), connect_xors ();
+}
+
+};
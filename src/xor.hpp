@@ -0,0 +1,38 @@
+#ifndef _xor_hpp_INCLUDED
+#define _xor_hpp_INCLUDED
+
+#include <vector>
+
+namespace CaDiCaL {
+
+using namespace std;
+
+// Parity constraint stating that the sum modulo two of its variables is
+// 'parity' (see 'xor.cpp').  The 'count' is the number of its variables
+// assigned on the trail before 'xor_propagated' and 'sum' the sum modulo
+// two of the values of those variables.  Redundant constraints are derived
+// by Gaussian elimination (see 'gauss.cpp').  Garbage constraints are
+// already disconnected from the occurrence lists.
+
+struct Xor {
+  bool redundant;
+  bool garbage;
+  bool parity;
+  bool sum;
+  int count;
+  vector<int> vars;
+  Xor (bool p) :
+    redundant (false), garbage (false), parity (p), sum (false), count (0)
+  { }
+};
+
+// Occurrence lists of variables in parity constraints.
+
+typedef vector<Xor*> Xors;
+
+typedef Xors::iterator xor_iterator;
+typedef Xors::const_iterator const_xor_iterator;
+
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+int main () {
+  CaDiCaL::Solver solver;
+  solver.add (-1), solver.add (2), solver.add (0);      // 1 -> 2
+  solver.add (-2), solver.add (3), solver.add (0);      // 2 -> 3
+  solver.add (-4), solver.add (-5), solver.add (0);
+  solver.assume (4), solver.assume (1);
+  solver.assume (-3);
+  int res = solver.solve ();
+  assert (res == 20);
+  assert (solver.failed (1));
+  assert (solver.failed (-3));
+  assert (!solver.failed (-1));
+  assert (!solver.failed (4));
+  res = solver.solve ();                // assumptions are reset
+  assert (res == 10);
+  assert (!solver.failed (1));
+  solver.assume (1);
+  res = solver.solve ();
+  assert (res == 10);
+  assert (solver.val (1) > 0);
+  assert (solver.val (3) > 0);
+  solver.assume (4), solver.assume (5);
+  res = solver.solve ();
+  assert (res == 20);
+  assert (solver.failed (4) || solver.failed (5));
+  solver.add (-3), solver.add (0);
+  solver.assume (-1);
+  res = solver.solve ();
+  assert (res == 10);
+  solver.assume (1);
+  res = solver.solve ();
+  assert (res == 20);
+  assert (solver.failed (1));
+  return 0;
+}
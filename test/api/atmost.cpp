@@ -0,0 +1,82 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <vector>
+using namespace std;
+static vector<int> lits (int a, int b, int c, int d = 0,
+                         int e = 0, int f = 0) {
+  vector<int> res;
+  res.push_back (a), res.push_back (b), res.push_back (c);
+  if (d) res.push_back (d);
+  if (e) res.push_back (e);
+  if (f) res.push_back (f);
+  return res;
+}
+static int count (CaDiCaL::Solver & solver, const vector<int> & lits) {
+  int res = 0;
+  for (size_t i = 0; i < lits.size (); i++)
+    if (solver.val (lits[i]) > 0) res++;
+  return res;
+}
+int main () {
+  {
+    // At most two out of five, at least one of each pair.
+    CaDiCaL::Solver solver;
+    solver.set ("check", 1);
+    solver.add_atmost (lits (1, 2, 3, 4, 5), 2);
+    solver.add (1), solver.add (2), solver.add (0);
+    solver.add (3), solver.add (4), solver.add (0);
+    assert (solver.solve () == 10);
+    assert (count (solver, lits (1, 2, 3, 4, 5)) == 2);
+    solver.assume (5);
+    assert (solver.solve () == 20);
+    solver.add (-1), solver.add (0);
+    assert (solver.solve () == 10);
+    assert (solver.val (2) > 0 && solver.val (-5) > 0);
+  }
+  {
+    // Duplicated and complementary literals, of which exactly one is true.
+    CaDiCaL::Solver solver;
+    solver.set ("check", 1);
+    solver.add_atmost (lits (1, 1, -1, 2, 2), 1);
+    assert (solver.solve () == 10);
+    assert (solver.val (2) < 0);
+    solver.assume (2);
+    assert (solver.solve () == 20);
+    solver.add_atmost (lits (3, 4, 3), 0);
+    assert (solver.solve () == 10);
+    assert (solver.val (3) < 0 && solver.val (4) < 0);
+  }
+  {
+    // Root level units decrease the bound and might contradict it.
+    CaDiCaL::Solver solver;
+    solver.set ("check", 1);
+    solver.add (1), solver.add (0);
+    solver.add (2), solver.add (0);
+    solver.add_atmost (lits (1, 2, 3), 2);
+    assert (solver.solve () == 10);
+    assert (solver.val (3) < 0);
+    solver.add_atmost (lits (-3, 1, 2), 2);
+    assert (solver.solve () == 20);
+  }
+  {
+    // After 'compact' all fixed variables are mapped to the same internal
+    // variable, which should not merge different true literals.
+    CaDiCaL::Solver solver;
+    solver.set ("check", 1);
+    solver.set ("compactint", 1);
+    solver.set ("compactmin", 1);
+    solver.add_xor (lits (7, 8, 4));
+    solver.add (8), solver.add (0);
+    solver.add_atmost (lits (-4, 3, -7), 1);
+    vector< vector<int> > batch (1, vector<int> (1, -7));
+    vector<int> results;
+    solver.solve_batch (batch, results);
+    solver.add_atmost (lits (8, -5, 6, 8, 4, 8), 2);
+    assert (solver.solve () == 10);
+    assert (count (solver, lits (8, -5, 6, 4)) <= 2);
+  }
+  return 0;
+}
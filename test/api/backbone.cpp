@@ -0,0 +1,55 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+// Random formulas with many backbone literals.  The backbone has to match
+// the one computed naively with one 'solve' per variable.  Every other
+// round compacts as often as possible with root level units and computes
+// the backbone under an assumption.
+static unsigned state = 1;
+static int pick (int n) {
+  state = state * 1103515245u + 12345u;
+  return (state >> 8) % n;
+}
+int main () {
+  for (int round = 0; round < 20; round++) {
+    const int vars = 30 + pick (30), clauses = vars * 4;
+    CaDiCaL::Solver solver, naive;
+    const int assumed = (round & 1) ? 2 : 0;
+    if (assumed) {
+      solver.set ("compactint", 1);
+      solver.set ("compactmin", 1);
+      solver.set ("compactlim", 0);
+      solver.add (1), solver.add (0);
+      naive.add (1), naive.add (0);
+    }
+    for (int i = 0; i < clauses; i++) {
+      for (int j = 0; j < 3; j++) {
+        const int lit = (pick (2) ? 1 : -1) * (pick (vars) + 1);
+        solver.add (lit), naive.add (lit);
+      }
+      solver.add (0), naive.add (0);
+    }
+    std::vector<int> lits;
+    if (assumed) solver.assume (assumed), naive.assume (assumed);
+    const int res = solver.backbone (lits);
+    assert (res == naive.solve ());
+    if (res == 20) { assert (lits.empty ()); continue; }
+    std::vector<int> model;
+    for (int idx = 1; idx <= vars; idx++) model.push_back (naive.val (idx));
+    size_t found = 0;
+    for (int idx = 1; idx <= vars; idx++) {
+      const int lit = model[idx - 1] < 0 ? -idx : idx;
+      if (assumed) naive.assume (assumed);
+      naive.assume (-lit);
+      if (naive.solve () == 10) continue;
+      assert (found < lits.size ());
+      assert (lits[found++] == lit);
+    }
+    assert (found == lits.size ());
+  }
+  return 0;
+}
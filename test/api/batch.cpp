@@ -0,0 +1,68 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+// Random formula with random queries drawn from a few common prefixes.  The
+// results of the batch have to match those of solving each query on its
+// own with a second solver.  Finally the core of the last query of a batch
+// under a pushed group only contains user assumptions.
+static unsigned state = 42;
+static int pick (int n) {
+  state = state * 1103515245u + 12345u;
+  return (state >> 8) % n;
+}
+static int literal (int vars) { return (pick (2) ? 1 : -1) * (pick (vars) + 1); }
+int main () {
+  const int vars = 60, clauses = 240;
+  CaDiCaL::Solver batch, single;
+  for (int i = 0; i < clauses; i++) {
+    for (int j = 0; j < 3; j++) {
+      const int lit = literal (vars);
+      batch.add (lit), single.add (lit);
+    }
+    batch.add (0), single.add (0);
+  }
+  std::vector< std::vector<int> > prefixes (4), queries (40);
+  for (size_t i = 0; i < prefixes.size (); i++)
+    for (int j = 0; j < 4; j++) prefixes[i].push_back (literal (vars));
+  for (size_t i = 0; i < queries.size (); i++) {
+    queries[i] = prefixes[pick (prefixes.size ())];
+    for (int j = pick (5); j; j--) queries[i].push_back (literal (vars));
+  }
+  std::vector<int> results;
+  for (int round = 0; round < 2; round++) {
+    batch.solve_batch (queries, results);
+    assert (results.size () == queries.size ());
+    int sat = 0, unsat = 0;
+    for (size_t i = 0; i < queries.size (); i++) {
+      for (size_t j = 0; j < queries[i].size (); j++)
+        single.assume (queries[i][j]);
+      const int res = single.solve ();
+      assert (res == results[i]);
+      if (res == 10) sat++;
+      if (res == 20) unsat++;
+    }
+    assert (sat + unsat == (int) queries.size ());
+    const int a = literal (vars), b = literal (vars);
+    batch.add (a), batch.add (b), batch.add (0);
+    single.add (a), single.add (b), single.add (0);
+  }
+  const int x = vars + 1, y = vars + 2;
+  batch.push ();
+  batch.add (-x), batch.add (-y), batch.add (0);
+  std::vector< std::vector<int> > last (1);
+  last[0].push_back (x), last[0].push_back (y);
+  batch.solve_batch (last, results);
+  assert (results.size () == 1 && results[0] == 20);
+  std::vector<int> failed;
+  std::vector<long> ids;
+  batch.core (failed, ids);
+  assert (failed.size () == 2);
+  for (size_t i = 0; i < failed.size (); i++)
+    assert (failed[i] == x || failed[i] == y);
+  batch.pop ();
+  return 0;
+}
@@ -0,0 +1,38 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+// Pigeon hole formula with 'n + 1' pigeons and 'n' holes guarded by the
+// selector '-1', which thus has to be assumed.  It is solved in many small
+// time slices of 100 conflicts each.
+static int ph (int p, int h, int n) { return 2 + p*n + h; }
+int main () {
+  const int n = 7;
+  CaDiCaL::Solver solver;
+  for (int p = 0; p <= n; p++) {
+    solver.add (1);
+    for (int h = 0; h < n; h++) solver.add (ph (p, h, n));
+    solver.add (0);
+  }
+  for (int h = 0; h < n; h++)
+    for (int p = 0; p <= n; p++)
+      for (int q = p + 1; q <= n; q++)
+        solver.add (-ph (p, h, n)), solver.add (-ph (q, h, n)),
+        solver.add (0);
+  CaDiCaL::Budget budget;
+  budget.conflicts = 100;
+  solver.assume (-1);
+  int res, slices = 0;
+  while (!(res = solver.solve (budget))) slices++;
+  assert (res == 20);
+  assert (slices > 1);
+  assert (solver.failed (-1));
+  budget.conflicts = 0;
+  solver.assume (-1);
+  res = solver.solve (budget);
+  assert (!res);
+  res = solver.solve ();        // not resumed thus no assumption anymore
+  assert (res == 10);
+  return 0;
+}
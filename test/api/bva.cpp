@@ -0,0 +1,61 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+// Pairwise at-most-one constraints are replaced by bounded variable addition
+// with internal variables while a proof is traced.  Models still have to
+// satisfy all original clauses, also after adding new external variables.
+// The proof has to contain the added variables after solving, which have
+// larger indices than all external variables.
+int main () {
+  const int n = 12;
+  CaDiCaL::Solver solver;
+  solver.set ("binary", 0);
+  bool opened = solver.proof ("api/bva.proof");
+  assert (opened), (void) opened;
+  solver.set ("eliminit", 0);
+  solver.set ("elimint", 1);
+#define PH(P,H) ((P)*n + (H) + 1)
+  for (int h = 0; h < n; h++)
+    for (int p = 0; p < n; p++)
+      for (int q = p + 1; q < n; q++)
+        solver.add (-PH (p, h)), solver.add (-PH (q, h)), solver.add (0);
+  for (int p = 0; p < n; p++) {
+    for (int h = 0; h < n; h++) solver.add (PH (p, h));
+    solver.add (0);
+  }
+  for (int round = 0; round < 2; round++) {
+    int res = solver.solve ();
+    assert (res == 10);
+    for (int h = 0; h < n; h++) {
+      int count = 0;
+      for (int p = 0; p < n; p++)
+        if (solver.val (PH (p, h)) > 0) count++;
+      assert (count == 1);
+    }
+    // A new external variable which puts two pigeons into the same hole.
+    const int e = n*n + round + 1;
+    solver.add (-e), solver.add (PH (round, 0)), solver.add (0);
+    solver.add (-e), solver.add (PH (round + 1, 0)), solver.add (0);
+    solver.assume (e);
+    res = solver.solve ();
+    assert (res == 20);
+    assert (solver.failed (e));
+  }
+  solver.add (n*n + 1), solver.add (0);
+  int res = solver.solve ();
+  assert (res == 20);
+  solver.close ();
+  FILE * file = fopen ("api/bva.proof", "r");
+  assert (file);
+  char token[32];
+  int added = 0;
+  while (fscanf (file, "%31s", token) == 1)
+    if (abs (atoi (token)) > n*n + 2) added++;
+  fclose (file);
+  assert (added > 0);
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <algorithm>
+#include <cassert>
+#include <vector>
+// Pigeon hole formula with 'n + 1' pigeons and 'n' holes, which is
+// minimally unsatisfiable, mixed with clauses over other variables.  All
+// pigeon hole clauses have to be in the core and no other clause.  Then
+// the core of failed assumptions is minimized too.  In the second round
+// root level units without selectors allow to compact after every conflict
+// and the pigeon clauses are added twice, thus only the minimized core
+// contains exactly one of the copies.
+int main () {
+  const int n = 5, extra = (n + 1) * n;
+  std::vector<int> assumptions;
+  std::vector<long> clauses;
+  for (int round = 0; round < 2; round++) {
+    CaDiCaL::Solver solver;
+    std::vector<long> expected, copies;
+    long id = 0;
+    if (round) {
+      solver.set ("compactint", 1);
+      solver.set ("compactmin", 1);
+      solver.set ("compactlim", 0);
+      for (int i = 10; i < 20; i++)
+        solver.add (extra + i), solver.add (0), id++;
+    }
+    solver.set ("core", 1);
+#define PH(P,H) ((P)*n + (H) + 1)
+#define OTHER(A,B) \
+  (solver.add (extra + (A)), solver.add (-extra - (B)), solver.add (0), id++)
+    OTHER (1, 2);
+    for (int p = 0; p <= n; p++) {
+      for (int h = 0; h < n; h++) solver.add (PH (p, h));
+      solver.add (0);
+      expected.push_back (id++);
+      if (round) {
+        for (int h = 0; h < n; h++) solver.add (PH (p, h));
+        solver.add (0);
+        copies.push_back (id++);
+      }
+      OTHER (p + 2, p + 3);
+    }
+    for (int h = 0; h < n; h++)
+      for (int p = 0; p <= n; p++)
+        for (int q = p + 1; q <= n; q++) {
+          solver.add (-PH (p, h)), solver.add (-PH (q, h)), solver.add (0);
+          expected.push_back (id++);
+        }
+    OTHER (3, 1);
+    for (int minimize = 0; minimize <= 1; minimize++) {
+      int res = solver.solve ();
+      assert (res == 20);
+      solver.core (assumptions, clauses, minimize);
+      assert (assumptions.empty ());
+      if (!round) { assert (clauses == expected); continue; }
+      size_t found = 0;
+      for (size_t i = 0; i < expected.size (); i++) {
+        const bool original =
+          std::find (clauses.begin (), clauses.end (), expected[i])
+            != clauses.end ();
+        const bool copy = i < copies.size () &&
+          std::find (clauses.begin (), clauses.end (), copies[i])
+            != clauses.end ();
+        assert (original || copy);
+        assert (!minimize || !original || !copy);
+        found += original + copy;
+      }
+      assert (found == clauses.size ());
+      if (minimize) assert (found == expected.size ());
+    }
+  }
+  CaDiCaL::Solver other;
+  other.add (1), other.add (2), other.add (0);
+  other.add (-3), other.add (4), other.add (0);
+  other.assume (5), other.assume (-1), other.assume (3);
+  other.assume (-4), other.assume (-2);
+  int res = other.solve ();
+  assert (res == 20);
+  other.core (assumptions, clauses, true);
+  assert (clauses.empty ());
+  assert (assumptions.size () == 2);
+  assert (assumptions[0] == -1 || assumptions[0] == 3);
+  assert (assumptions[1] == (assumptions[0] == -1 ? -2 : -4));
+  return 0;
+}
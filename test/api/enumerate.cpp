@@ -0,0 +1,101 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <set>
+#include <vector>
+using namespace std;
+using namespace CaDiCaL;
+// Collects the projected models and checks that they are all different.
+// By default 'enumerate' does not change the formula, while with
+// 'enumeratekeep' another 'enumerate' continues with the remaining models.
+// Guarded blocking clauses are traced in proofs, while kept blocking
+// clauses are rejected if proofs are traced.
+struct Collector : public Enumerator {
+  set< vector<int> > models;
+  bool model (const vector<int> & lits) {
+    bool inserted = models.insert (lits).second;
+    assert (inserted), (void) inserted;
+    return true;
+  }
+};
+// The clause '1 2 3' with five free variables '4' to '8' and auxiliary
+// variables '9 = 1 & 2' and '10 = 3 | 9' (which are not projected).
+static void formula (Solver & solver) {
+  solver.add (1), solver.add (2), solver.add (3), solver.add (0);
+  solver.add (-9), solver.add (1), solver.add (0);
+  solver.add (-9), solver.add (2), solver.add (0);
+  solver.add (9), solver.add (-1), solver.add (-2), solver.add (0);
+  solver.add (10), solver.add (-3), solver.add (0);
+  solver.add (10), solver.add (-9), solver.add (0);
+  solver.add (-10), solver.add (3), solver.add (9), solver.add (0);
+  for (int i = 4; i <= 8; i++) solver.add (i), solver.add (-i), solver.add (0);
+}
+int main () {
+  vector<int> projection;
+  for (int i = 1; i <= 3; i++) projection.push_back (i);
+  {
+    Solver solver;
+    formula (solver);
+    Collector collector;
+    long res = solver.enumerate (projection, &collector);
+    assert (res == 7);
+    assert (collector.models.size () == 7);
+    assert (solver.solve () == 10);
+    res = solver.enumerate (projection);
+    assert (res == 7);
+  }
+  {
+    Solver solver;
+    formula (solver);
+    for (int i = 4; i <= 8; i++) projection.push_back (i);
+    long res = solver.enumerate (projection);
+    assert (res == 7*32);
+    projection.resize (3);
+  }
+  {
+    Solver solver;
+    solver.set ("enumeratekeep", 1);
+    formula (solver);
+    long res = solver.enumerate (projection, 0, 5);
+    assert (res == 5);
+    res = solver.enumerate (projection);
+    assert (res == 2);
+    assert (solver.solve () == 20);
+  }
+  {
+    for (int keep = 0; keep <= 1; keep++) {
+      Solver solver;
+      solver.set ("enumeratekeep", keep);
+      formula (solver);
+      solver.assume (-1);
+      Collector collector;
+      long res = solver.enumerate (projection, &collector);
+      assert (res == 3);
+      for (set< vector<int> >::const_iterator i = collector.models.begin ();
+           i != collector.models.end (); i++)
+        assert ((*i)[0] == -1);
+      res = solver.enumerate (projection);
+      assert (res == (keep ? 4 : 7));
+    }
+  }
+  {
+    Solver solver;
+    solver.set ("binary", 0);
+    bool opened = solver.proof ("api/enumerate.proof");
+    assert (opened), (void) opened;
+    formula (solver);
+    long res = solver.enumerate (projection);
+    assert (res == 7);
+    solver.set ("enumeratekeep", 1);
+    res = solver.enumerate (projection);
+    assert (res == -1);
+    assert (solver.solve () == 10);
+    solver.add (-1), solver.add (0);
+    solver.add (-2), solver.add (0);
+    solver.add (-3), solver.add (0);
+    assert (solver.solve () == 20);
+  }
+  return 0;
+}
@@ -0,0 +1,58 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+// Chain of equivalences '1 = 2 = ... = n' which is simplified by 'elim'
+// and 'decompose' during the first 'solve'.  Then only the frozen end
+// points are used in the second call, but in the third call all the other
+// variables are used again too and thus have to be restored.  Finally the
+// representative '1' of a chain becomes fixed while substituting, since
+// it occurs together with the other end point, which is used again later.
+int main () {
+  const int n = 100;
+  CaDiCaL::Solver solver;
+  solver.set ("eliminit", 0);
+  solver.set ("elimint", 1);
+  solver.set ("probeinit", 0);
+  solver.set ("probeint", 1);
+  for (int i = 1; i < n; i++) {
+    solver.add (-i), solver.add (i + 1), solver.add (0);
+    solver.add (i), solver.add (-i - 1), solver.add (0);
+  }
+  solver.freeze (1), solver.freeze (n);
+  assert (solver.frozen (1) && solver.frozen (-n));
+  assert (!solver.frozen (2));
+  int res = solver.solve ();
+  assert (res == 10);
+  solver.assume (1), solver.assume (-n);
+  res = solver.solve ();
+  assert (res == 20);
+  assert (solver.failed (1) && solver.failed (-n));
+  solver.melt (1), solver.melt (n);
+  assert (!solver.frozen (1));
+  for (int i = 2; i < n; i++)
+    solver.add (i), solver.add (0);
+  res = solver.solve ();
+  assert (res == 10);
+  for (int i = 1; i <= n; i++) assert (solver.val (i) > 0);
+  solver.add (-n/2), solver.add (0);
+  res = solver.solve ();
+  assert (res == 20);
+  CaDiCaL::Solver other;
+  other.set ("check", 1);
+  other.set ("probeinit", 0);
+  other.set ("probeint", 1);
+  for (int i = 1; i < n; i++) {
+    other.add (-i), other.add (i + 1), other.add (0);
+    other.add (i), other.add (-i - 1), other.add (0);
+  }
+  other.add (1), other.add (n), other.add (0);
+  other.freeze (1);
+  res = other.solve ();
+  assert (res == 10);
+  other.add (-n/2), other.add (0);
+  res = other.solve ();
+  assert (res == 20);
+  return 0;
+}
@@ -0,0 +1,54 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <cstdlib>
+// Pigeon hole formulas with 'n' holes for 'n' and 'n + 1' pigeons, where
+// the hole constraints are permanent and the pigeons constraints are added
+// in nested groups.  Learned clauses exported to the learner never contain
+// activation literals (which would show up as zero literals).
+struct Exporter : public CaDiCaL::Learner {
+  int size, max_var;
+  bool learning (int s) { size = s; return true; }
+  void learn (int lit) {
+    if (size--) assert (lit && abs (lit) <= max_var);
+    else assert (!lit);
+  }
+};
+int main () {
+  const int n = 6;
+  CaDiCaL::Solver solver;
+  solver.set ("eliminit", 0);
+  solver.set ("elimint", 1);
+  Exporter exporter;
+  exporter.max_var = (n + 1) * n;
+  solver.connect_learner (&exporter);
+#define PH(P,H) ((P)*n + (H) + 1)
+  for (int h = 0; h < n; h++)
+    for (int p = 0; p <= n; p++)
+      for (int q = p + 1; q <= n; q++)
+        solver.add (-PH (p, h)), solver.add (-PH (q, h)), solver.add (0);
+  for (int round = 0; round < 10; round++) {
+    solver.push ();
+    for (int p = 0; p < n; p++) {
+      for (int h = 0; h < n; h++) solver.add (PH (p, h));
+      solver.add (0);
+    }
+    int res = solver.solve ();
+    assert (res == 10);
+    solver.push ();
+    for (int h = 0; h < n; h++) solver.add (PH (n, h));
+    solver.add (0);
+    res = solver.solve ();
+    assert (res == 20);
+    solver.pop ();
+    res = solver.solve ();
+    assert (res == 10);
+    solver.pop ();
+    for (int p = 0; p <= n; p++) solver.assume (-PH (p, round % n));
+    res = solver.solve ();
+    assert (res == 10);
+  }
+  return 0;
+}
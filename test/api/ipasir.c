@@ -0,0 +1,78 @@
+#include "../../src/ipasir.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <string.h>
+
+static int calls, learned, longest;
+
+static int terminate (void * state) {
+  assert (state == &calls);
+  return ++calls >= 100;
+}
+
+static void learn (void * state, int * clause) {
+  int size = 0;
+  assert (state == &learned);
+  while (clause[size]) size++;
+  if (size > longest) longest = size;
+  learned++;
+}
+
+/* Pigeon hole formula with 'n+1' pigeons and 'n' holes. */
+
+static void pigeon_hole (void * solver, int n) {
+  int i, j, k;
+  for (i = 0; i <= n; i++) {
+    for (j = 0; j < n; j++) ipasir_add (solver, i*n + j + 1);
+    ipasir_add (solver, 0);
+  }
+  for (j = 0; j < n; j++)
+    for (i = 0; i <= n; i++)
+      for (k = i + 1; k <= n; k++) {
+        ipasir_add (solver, -(i*n + j + 1));
+        ipasir_add (solver, -(k*n + j + 1));
+        ipasir_add (solver, 0);
+      }
+}
+
+int main () {
+  void * solver = ipasir_init ();
+  int res;
+  assert (!strncmp (ipasir_signature (), "cadical", 7));
+  ipasir_add (solver, -1); ipasir_add (solver, 2); ipasir_add (solver, 0);
+  ipasir_assume (solver, 1);
+  ipasir_assume (solver, -2);
+  res = ipasir_solve (solver);
+  assert (res == 20);
+  assert (ipasir_failed (solver, 1));
+  assert (ipasir_failed (solver, -2));
+  ipasir_assume (solver, 1);
+  res = ipasir_solve (solver);
+  assert (res == 10);
+  assert (ipasir_val (solver, 1) == 1);
+  assert (ipasir_val (solver, 2) == 2);
+  assert (ipasir_val (solver, -2) == 2);
+  ipasir_release (solver);
+
+  solver = ipasir_init ();
+  pigeon_hole (solver, 6);
+  ipasir_set_learn (solver, &learned, 3, learn);
+  res = ipasir_solve (solver);
+  assert (res == 20);
+  assert (learned > 0);
+  assert (longest <= 3);
+  ipasir_release (solver);
+
+  solver = ipasir_init ();
+  pigeon_hole (solver, 12);
+  ipasir_set_terminate (solver, &calls, terminate);
+  res = ipasir_solve (solver);
+  assert (res == 0);
+  assert (calls == 100);
+  ipasir_release (solver);
+  return 0;
+}
@@ -0,0 +1,118 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <vector>
+using namespace std;
+class Bounds : public CaDiCaL::Bounder {
+public:
+  long lower, upper;
+  Bounds () : lower (0), upper (-1) { }
+  void bounds (long l, long u) {
+    assert (lower <= l), lower = l;
+    assert (upper < 0 || (0 <= u && u <= upper)), upper = u;
+    assert (u < 0 || l <= u);
+  }
+};
+// At least two out of '1', '2' and '3'.
+static void two_out_of_three (CaDiCaL::Solver & solver) {
+  solver.add (1), solver.add (2), solver.add (0);
+  solver.add (2), solver.add (3), solver.add (0);
+  solver.add (1), solver.add (3), solver.add (0);
+}
+static long falsified (CaDiCaL::Solver & solver,
+                       const vector<int> & soft,
+                       const vector<long> & weights) {
+  long res = 0;
+  for (size_t i = 0; i < soft.size (); i++)
+    if (solver.val (soft[i]) < 0) res += weights[i];
+  return res;
+}
+int main () {
+  {
+    CaDiCaL::Solver solver;
+    two_out_of_three (solver);
+    vector<int> soft;
+    vector<long> weights;
+    soft.push_back (-1), weights.push_back (3);
+    soft.push_back (-2), weights.push_back (2);
+    soft.push_back (-3), weights.push_back (1);
+    long cost;
+    Bounds bounds;
+    assert (solver.optimize (soft, weights, cost, &bounds) == 10);
+    assert (cost == 3);
+    assert (bounds.lower == 3 && bounds.upper == 3);
+    assert (falsified (solver, soft, weights) == 3);
+    assert (solver.val (-1) > 0);
+    // Optimizing again with different weights and a free soft literal.
+    weights[0] = 1, weights[1] = 5, weights[2] = 5;
+    soft.push_back (4), weights.push_back (7);
+    assert (solver.optimize (soft, weights, cost) == 10);
+    assert (cost == 6);
+    assert (falsified (solver, soft, weights) == 6);
+    assert (solver.val (1) > 0 && solver.val (4) > 0);
+    // Soft literals do not restrict plain solving afterwards.
+    solver.add (-1), solver.add (0);
+    assert (solver.solve () == 10);
+    assert (solver.val (2) > 0 && solver.val (3) > 0);
+  }
+  {
+    CaDiCaL::Solver solver;
+    solver.add (1), solver.add (0);
+    solver.add (-1), solver.add (0);
+    vector<int> soft (1, 2);
+    vector<long> weights (1, 1);
+    long cost;
+    assert (solver.optimize (soft, weights, cost) == 20);
+    assert (cost < 0);
+  }
+  {
+    // The optimization guard has to survive compacting after the unit.
+    CaDiCaL::Solver solver;
+    solver.set ("compactint", 1);
+    solver.set ("compactmin", 1);
+    solver.set ("compactlim", 0);
+    two_out_of_three (solver);
+    solver.add (5), solver.add (0);
+    vector<int> soft;
+    vector<long> weights;
+    for (int lit = 1; lit <= 5; lit++)
+      soft.push_back (-lit), weights.push_back (lit);
+    for (int round = 0; round < 3; round++) {
+      long cost;
+      assert (solver.optimize (soft, weights, cost) == 10);
+      assert (cost == 8);
+      assert (falsified (solver, soft, weights) == 8);
+    }
+    assert (solver.solve () == 10);
+  }
+  {
+    // Repeated optimization with default options on exactly one out of
+    // twelve, encoded pairwise, where the soft literal with weight twelve
+    // has to be true in every round.
+    const int n = 12;
+    CaDiCaL::Solver solver;
+    for (int i = 1; i <= n; i++) solver.add (i);
+    solver.add (0);
+    for (int i = 1; i <= n; i++)
+      for (int j = i + 1; j <= n; j++)
+        solver.add (-i), solver.add (-j), solver.add (0);
+    for (int round = 0; round < 20; round++) {
+      vector<int> soft;
+      vector<long> weights;
+      for (int i = 1; i <= n; i++)
+        soft.push_back (i), weights.push_back (1 + (i + round) % n);
+      long cost;
+      assert (solver.optimize (soft, weights, cost) == 10);
+      assert (cost == n*(n + 1)/2 - n);
+      assert (falsified (solver, soft, weights) == cost);
+      int count = 0;
+      for (int i = 1; i <= n; i++)
+        if (solver.val (i) > 0) count++, assert (weights[i-1] == n);
+      assert (count == 1);
+      assert (solver.solve () == 10);
+    }
+  }
+  return 0;
+}
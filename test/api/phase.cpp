@@ -0,0 +1,54 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <vector>
+// Setting the phases to a model of a random formula has to give exactly
+// this model without any conflict.  Then a phase hint only has an effect
+// if its variable is also prioritized.
+static unsigned state = 7;
+static int pick (int n) {
+  state = state * 1103515245u + 12345u;
+  return (state >> 8) % n;
+}
+int main () {
+  const int vars = 200, clauses = 800;
+  std::vector<int> formula;
+  for (int i = 0; i < clauses; i++) {
+    for (int j = 0; j < 3; j++)
+      formula.push_back ((pick (2) ? 1 : -1) * (pick (vars) + 1));
+    formula.push_back (0);
+  }
+  CaDiCaL::Solver first;
+  for (size_t i = 0; i < formula.size (); i++) first.add (formula[i]);
+  int res = first.solve ();
+  assert (res == 10);
+  CaDiCaL::Solver second;
+  second.set ("clim", 1);
+  for (size_t i = 0; i < formula.size (); i++) second.add (formula[i]);
+  for (int idx = 1; idx <= vars; idx++)
+    second.phase (first.val (idx) < 0 ? -idx : idx);
+  res = second.solve ();
+  assert (res == 10);
+  for (int idx = 1; idx <= vars; idx++)
+    assert (second.val (idx) == first.val (idx));
+  CaDiCaL::Solver third;
+  third.set ("phase", 0);
+  third.add (1), third.add (2), third.add (0);
+  res = third.solve ();
+  assert (res == 10);
+  const int decided = third.val (1) < 0 ? 1 : 2, implied = 3 - decided;
+  assert (third.val (implied) > 0);
+  third.add (3), third.add (4), third.add (0);
+  third.phase (-implied);
+  res = third.solve ();
+  assert (res == 10);
+  assert (third.val (implied) > 0);
+  third.phase (-implied);
+  third.prioritize (implied);
+  res = third.solve ();
+  assert (res == 10);
+  assert (third.val (implied) < 0 && third.val (decided) > 0);
+  return 0;
+}
@@ -0,0 +1,94 @@
+#include "../../src/cadical.hpp"
+#include "../../src/server.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+extern "C" {
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+};
+// Start a server with one worker in a child process, run a session with
+// two queries and a time limited query through the socket and then stop
+// the server with 'SIGTERM'.
+static const char * path = "api/server.sock";
+static std::string response (FILE * file) {
+  std::string res;
+  char line[1024];
+  while (fgets (line, sizeof line, file)) {
+    res += line;
+    if (!strncmp (line, "ok", 2) || !strncmp (line, "error", 5)) break;
+  }
+  return res;
+}
+static std::string request (FILE * file, const char * line) {
+  fputs (line, file);
+  fflush (file);
+  return response (file);
+}
+int main () {
+  unlink (path);
+  const int pid = fork ();
+  assert (pid >= 0);
+  if (!pid) {
+    std::vector<const char *> options;
+    const char * err = CaDiCaL::Server::serve (path, 1, options);
+    _exit (err ? 1 : 0);
+  }
+  int fd = -1;
+  for (int tries = 0; fd < 0 && tries < 100; tries++) {
+    struct sockaddr_un addr;
+    memset (&addr, 0, sizeof addr);
+    addr.sun_family = AF_UNIX;
+    strcpy (addr.sun_path, path);
+    fd = socket (AF_UNIX, SOCK_STREAM, 0);
+    assert (fd >= 0);
+    if (!connect (fd, (struct sockaddr *) &addr, sizeof addr)) break;
+    close (fd), fd = -1;
+    usleep (10000);
+  }
+  assert (fd >= 0);
+  FILE * file = fdopen (fd, "r+");
+  assert (file);
+  assert (request (file, "add 1 2 0\n") == "ok\n");
+  assert (request (file, "add -1 0\n") == "ok\n");
+  assert (request (file, "solve\n") == "s SATISFIABLE\nok\n");
+  assert (request (file, "model\n") == "v -1 2 0\nok\n");
+  assert (request (file, "assume -2 0\n") == "ok\n");
+  assert (request (file, "solve time=10\n") == "s UNSATISFIABLE\nok\n");
+  assert (request (file, "model\n") == "error no model\n");
+  // Hard pigeon hole formula interrupted by the 'time' limit.
+  assert (request (file, "reset\n") == "ok\n");
+  assert (request (file, "set --elim=0\n") == "ok\n");
+  const int n = 12;
+  char line[256];
+  for (int p = 0; p <= n; p++) {
+    std::string clause = "add";
+    for (int h = 0; h < n; h++)
+      sprintf (line, " %d", p*n + h + 1), clause += line;
+    clause += " 0\n";
+    assert (request (file, clause.c_str ()) == "ok\n");
+  }
+  for (int h = 0; h < n; h++)
+    for (int p = 0; p <= n; p++)
+      for (int q = p + 1; q <= n; q++) {
+        sprintf (line, "add %d %d 0\n", -(p*n + h + 1), -(q*n + h + 1));
+        assert (request (file, line) == "ok\n");
+      }
+  assert (request (file, "solve time=1\n") == "s UNKNOWN\nok\n");
+  assert (request (file, "quit\n") == "ok\n");
+  fclose (file);
+  kill (pid, SIGTERM);
+  int status;
+  assert (waitpid (pid, &status, 0) == pid);
+  assert (WIFEXITED (status) && !WEXITSTATUS (status));
+  return 0;
+}
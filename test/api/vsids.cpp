@@ -0,0 +1,82 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <vector>
+// Switching between EVSIDS scores and the VMTF queue between incremental
+// calls.  Small random formulas are checked against enumerating all
+// assignments.  Larger random formulas with a small score decay (forcing
+// frequent rescaling) have to give the same result as with the queue.
+static unsigned state = 1;
+static int pick (int n) {
+  state = state * 1103515245u + 12345u;
+  return (state >> 8) % n;
+}
+static bool satisfies (const std::vector< std::vector<int> > & clauses,
+                       unsigned m) {
+  for (size_t i = 0; i < clauses.size (); i++) {
+    bool satisfied = false;
+    for (size_t j = 0; !satisfied && j < clauses[i].size (); j++) {
+      const int lit = clauses[i][j], idx = lit < 0 ? -lit : lit;
+      satisfied = ((m >> (idx - 1)) & 1) == (lit > 0);
+    }
+    if (!satisfied) return false;
+  }
+  return true;
+}
+int main () {
+  for (int round = 0; round < 200; round++) {
+    const int vars = 4 + pick (11);
+    CaDiCaL::Solver solver;
+    solver.set ("check", 1);
+    std::vector< std::vector<int> > clauses;
+    for (int call = 0; call < 6; call++) {
+      solver.set ("vsids", pick (2));
+      const int n = 1 + pick (2*vars);
+      for (int i = 0; i < n; i++) {
+        std::vector<int> clause;
+        for (int j = 0; j < 3; j++) {
+          const int lit = (pick (2) ? 1 : -1) * (pick (vars) + 1);
+          clause.push_back (lit);
+          solver.add (lit);
+        }
+        solver.add (0);
+        clauses.push_back (clause);
+      }
+      if (!pick (3)) solver.prioritize (pick (vars) + 1);
+      std::vector<int> assumptions;
+      const int k = pick (3);
+      for (int i = 0; i < k; i++) {
+        const int lit = (pick (2) ? 1 : -1) * (pick (vars) + 1);
+        std::vector<int> unit (1, lit);
+        assumptions.push_back (lit);
+        solver.assume (lit);
+        clauses.push_back (unit);
+      }
+      bool expected = false;
+      for (unsigned m = 0; !expected && m < (1u << vars); m++)
+        expected = satisfies (clauses, m);
+      const int res = solver.solve ();
+      assert (res == (expected ? 10 : 20));
+      clauses.resize (clauses.size () - assumptions.size ());
+      if (!expected && assumptions.empty ()) break;
+    }
+  }
+  for (int round = 0; round < 20; round++) {
+    const int vars = 100 + pick (100), n = (426 * vars) / 100;
+    CaDiCaL::Solver vsids, vmtf;
+    vsids.set ("check", 1);
+    vsids.set ("vsids", 1);
+    vsids.set ("vsidsdecay", 0.5);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < 3; j++) {
+        const int lit = (pick (2) ? 1 : -1) * (pick (vars) + 1);
+        vsids.add (lit), vmtf.add (lit);
+      }
+      vsids.add (0), vmtf.add (0);
+    }
+    assert (vsids.solve () == vmtf.solve ());
+  }
+  return 0;
+}
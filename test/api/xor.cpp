@@ -0,0 +1,76 @@
+#include "../../src/cadical.hpp"
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <vector>
+using namespace std;
+static vector<int> lits (int a, int b, int c = 0) {
+  vector<int> res;
+  res.push_back (a), res.push_back (b);
+  if (c) res.push_back (c);
+  return res;
+}
+// Adds the four clauses of 'a + b + c = 1 (mod 2)'.
+static void encode (CaDiCaL::Solver & solver, int a, int b, int c) {
+  solver.add (a), solver.add (b), solver.add (c), solver.add (0);
+  solver.add (a), solver.add (-b), solver.add (-c), solver.add (0);
+  solver.add (-a), solver.add (b), solver.add (-c), solver.add (0);
+  solver.add (-a), solver.add (-b), solver.add (c), solver.add (0);
+}
+// Chain 'x(i) + x(i+1) + y(i) = 1' for 'i = 1..n' encoded in clauses with
+// 'x(i) = i' and 'y(i) = n + 1 + i'.  Its sum is 'x(1) + x(n+1) + y(1) +
+// ... + y(n) = n', which for even 'n' contradicts the native constraint
+// with 'x(n+1)' instead of its negation if 'closed'.
+static int chain (int n, bool closed) {
+  CaDiCaL::Solver solver;
+  solver.set ("check", 1);
+  solver.set ("probeinit", 0);
+  for (int i = 1; i <= n; i++) encode (solver, i, i + 1, n + 1 + i);
+  vector<int> ends = lits (1, closed ? n + 1 : -(n + 1));
+  for (int i = 1; i <= n; i++) ends.push_back (n + 1 + i);
+  solver.add_xor (ends);
+  return solver.solve ();
+}
+int main () {
+  {
+    CaDiCaL::Solver solver;
+    solver.set ("check", 1);
+    solver.add_xor (lits (1, 2, 3));
+    solver.assume (1), solver.assume (2);
+    assert (solver.solve () == 10);
+    assert (solver.val (3) > 0);
+    solver.assume (1), solver.assume (-3);
+    assert (solver.solve () == 10);
+    assert (solver.val (2) < 0);
+    // Complementary literals cancel each other but flip the parity.
+    solver.add_xor (lits (-4, 4, 5));
+    assert (solver.solve () == 10);
+    assert (solver.val (5) < 0);
+    solver.add (1), solver.add (0);
+    solver.add (2), solver.add (0);
+    assert (solver.solve () == 10);
+    assert (solver.val (3) > 0);
+    solver.add_xor (lits (3, 1, -2));
+    assert (solver.solve () == 20);
+  }
+  assert (chain (20, false) == 10);
+  assert (chain (20, true) == 20);
+  {
+    // Units of parity constraints after 'compact' map fixed variables to
+    // the same internal variable.
+    CaDiCaL::Solver solver;
+    solver.set ("check", 1);
+    solver.set ("compactint", 1);
+    solver.set ("compactmin", 1);
+    solver.add_xor (lits (7, 8, 4));
+    solver.add (8), solver.add (0);
+    solver.add (-4), solver.add (0);
+    assert (solver.solve () == 10);
+    solver.add_xor (lits (8, 4, 5));
+    solver.add_xor (lits (8, -7, 6));
+    assert (solver.solve () == 10);
+    assert (solver.val (5) < 0 && solver.val (6) > 0);
+  }
+  return 0;
+}
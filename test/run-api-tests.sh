@@ -46,5 +46,21 @@ crun () {
 run newdelete
 run unit
 run morenmore
+run server
+run assume
+run freeze
+run budget
+run enumerate
+run group
+run batch
+run backbone
+run core
+run phase
+run optimize
+run atmost
+run xor
+run vsids
+run bva
 
 crun ctest
+crun ipasir
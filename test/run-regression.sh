@@ -44,24 +44,31 @@ fi
 ok=0
 failed=0
 
+# Usage: run <name> <expected exit code> [ <option> ... ]
+
 run () {
-  if [ -f cnfs/$1.sol ]
+  name=$1
+  expected=$2
+  shift
+  shift
+  if [ -f cnfs/$name.sol ]
   then
-    solopts=" -s cnfs/$1.sol"
+    solopts=" -s cnfs/$name.sol"
   else
     solopts=""
   fi
-  if [ $2 = 20 -a x"$checker" = xnone ]
+  if [ $expected = 20 -a x"$checker" = xnone ]
   then
     proofopts=""
   else
-    proofopts=" cnfs/$1.proof"
+    proofopts=" cnfs/$name.proof"
   fi
-  opts="cnfs/$1.cnf$solopts$proofopts"
-  echo -n "$binary $opts # $2 ..."
-  $binary $opts 1>cnfs/$1.log 2>cnfs/$1.err
+  opts="cnfs/$name.cnf$solopts$proofopts"
+  [ $# = 0 ] || opts="$* $opts"
+  echo -n "$binary $opts # $expected ..."
+  $binary $opts 1>cnfs/$name.log 2>cnfs/$name.err
   res=$?
-  if [ $res = $2 ]
+  if [ $res = $expected ]
   then 
     if [ $res = 10 ]
     then
@@ -72,13 +79,13 @@ run () {
       echo " ok"
       ok=`expr $ok + 1`
     else
-      $checker cnfs/$1.cnf cnfs/$1.proof 1>&2 >cnfs/$1.check
+      $checker cnfs/$name.cnf cnfs/$name.proof 1>&2 >cnfs/$name.check
       if test $?
       then
 	echo " ok (proof checked)"
 	ok=`expr $ok + 1`
       else
-	echo " failed (proof check '$checker cnfs/$1.cnf cnfs/$1.proof' failed)"
+	echo " failed (proof check '$checker cnfs/$name.cnf cnfs/$name.proof' failed)"
 	failed=`expr $failed + 1`
       fi
     fi
@@ -125,8 +132,13 @@ run full7 20
 run regr000 10
 run elimclash 20
 run elimredundant 10
+run elimredundant 10 --core=1
 
 run block0 10
+run block0 10 --core=1
+
+run icnf0 10
+run icnf1 10
 
 run prime4 10
 run prime9 10
@@ -143,6 +155,7 @@ run prime1369 10
 run prime1681 10
 run prime1849 10
 run prime2209 10
+run prime2209 10 --target=2 --rephaseint=1
 
 run sqrt2809 10
 run sqrt3481 10
@@ -155,6 +168,8 @@ run sqrt6889 10
 run sqrt7921 10
 run sqrt9409 10
 run sqrt10201 10
+run sqrt10201 10 --rephaseint=1
+run sqrt10201 10 --rephaseint=1 --walk=0
 run sqrt10609 10
 run sqrt11449 10
 run sqrt11881 10
@@ -169,12 +184,15 @@ run ph3 20
 run ph4 20
 run ph5 20
 run ph6 20
+run ph6 20 --target=2 --rephaseint=1
 
 run add4 20
 run add8 20
 run add16 20
 run add32 20
 run add64 20
+run add64 20 --reduceinit=10 --reduceinc=1 --reducetier2=1
+run add64 20 --reduceinit=10 --reduceinc=1 --reducetier2=1000 --keepglue=1
 run add128 20
 
 run prime65537 20